@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * @file   AffixBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Affix dictionary against the fully expanded word list.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <unordered_set>
+
+namespace
+{
+	//! English inflection rules the benchmark compresses the word list with.
+	struct Rule
+	{
+		bool bPrefix;
+		char flag;
+		std::string_view strip;
+		std::string_view affix;
+		std::string_view condition; //!< ASCII only
+	};
+
+	constexpr Rule kRULES[] = {
+		{ true, 'U', "", "un", "." },
+		{ true, 'A', "", "re", "." },
+		{ false, 'S', "y", "ies", "[^aeiou]y" },
+		{ false, 'S', "", "s", "[aeiou]y" },
+		{ false, 'S', "", "es", "[sxzh]" },
+		{ false, 'S', "", "s", "[^sxzhy]" },
+		{ false, 'D', "", "d", "e" },
+		{ false, 'D', "y", "ied", "[^aeiou]y" },
+		{ false, 'D', "", "ed", "[^ey]" },
+		{ false, 'D', "", "ed", "[aeiou]y" },
+		{ false, 'G', "e", "ing", "e" },
+		{ false, 'G', "", "ing", "[^e]" },
+		{ false, 'R', "", "r", "e" },
+		{ false, 'R', "y", "ier", "[^aeiou]y" },
+		{ false, 'R', "", "er", "[^ey]" },
+		{ false, 'L', "", "ly", "." },
+		{ false, 'N', "", "ness", "." },
+		{ false, 'M', "", "ment", "." }
+	};
+	constexpr std::string_view kFLAGS = "UASDGRLNM";
+
+	//! Match an ASCII condition against the end (suffix) or start (prefix) of a stem.
+	bool MatchesCondition(std::string_view condition, std::string_view stem, bool bSuffix)
+	{
+		std::vector<std::pair<std::string_view, bool>> elements; // (characters, negated), "." is ("", true)
+		for (std::size_t offset = 0; offset < condition.size(); )
+		{
+			if (condition[offset] == '[')
+			{
+				const std::size_t kEnd = condition.find(']', offset);
+				const bool kbNegated = condition[offset + 1] == '^';
+				elements.emplace_back(condition.substr(offset + 1 + kbNegated, kEnd - offset - 1 - kbNegated), kbNegated);
+				offset = kEnd + 1;
+			}
+			else
+			{
+				elements.emplace_back((condition[offset] == '.') ? "" : condition.substr(offset, 1), condition[offset] == '.');
+				++offset;
+			}
+		}
+
+		if (elements.size() > stem.size())
+		{
+			return false;
+		}
+
+		const std::size_t kStart = bSuffix ? stem.size() - elements.size() : 0;
+		for (std::size_t index = 0; index < elements.size(); ++index)
+		{
+			const auto &[kChars, kbNegated] = elements[index];
+			if ((kChars.find(stem[kStart + index]) != std::string_view::npos) == kbNegated)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//! Forms flag generates from stem (empty if no rule of the flag applies).
+	std::vector<std::string> GetForms(std::string_view stem, char flag)
+	{
+		std::vector<std::string> forms;
+		for (const Rule &kRule : kRULES)
+		{
+			if (kRule.flag != flag || !MatchesCondition(kRule.condition, stem, !kRule.bPrefix))
+			{
+				continue;
+			}
+
+			if (kRule.bPrefix && stem.starts_with(kRule.strip))
+			{
+				forms.push_back(std::string(kRule.affix) + std::string(stem.substr(kRule.strip.size())));
+			}
+			else if (!kRule.bPrefix && stem.ends_with(kRule.strip))
+			{
+				forms.push_back(std::string(stem.substr(0, stem.size() - kRule.strip.size())) + std::string(kRule.affix));
+			}
+		}
+
+		return forms;
+	}
+
+	/**
+	 * Compress a word list into .aff & .dic file contents.
+	 *
+	 * A word takes a flag if every form the flag generates is listed too;
+	 * prefixes don't combine with suffixes, so the dictionary accepts exactly
+	 * the words of the list.
+	 */
+	std::pair<std::string, std::string> CompressWordList(const Lexi::Bench::WordList &kWords)
+	{
+		std::string affixText = "SET UTF-8\n";
+		for (const char kFlag : kFLAGS)
+		{
+			const auto kNumRules = std::ranges::count(kRULES, kFlag, &Rule::flag);
+			const bool kbPrefix = std::ranges::find(kRULES, kFlag, &Rule::flag)->bPrefix;
+			affixText += std::format("{} {} {} {}\n", kbPrefix ? "PFX" : "SFX", kFlag, kbPrefix ? "N" : "Y", kNumRules);
+			for (const Rule &kRule : kRULES)
+			{
+				if (kRule.flag == kFlag)
+				{
+					affixText += std::format("{} {} {} {} {}\n", kbPrefix ? "PFX" : "SFX", kFlag,
+											 kRule.strip.empty() ? "0" : kRule.strip, kRule.affix, kRule.condition);
+				}
+			}
+		}
+
+		const std::unordered_set<std::string_view> kListed(kWords.begin(), kWords.end());
+		std::unordered_set<std::string> covered;
+		std::vector<std::pair<std::string_view, std::string>> entries; // (stem, flags)
+		for (const auto &kWord : kWords)
+		{
+			std::string flags;
+			for (const char kFlag : kFLAGS)
+			{
+				const auto kForms = GetForms(kWord, kFlag);
+				if (!kForms.empty() && std::ranges::all_of(kForms, [&](const std::string &kForm) { return kListed.contains(kForm); }))
+				{
+					flags += kFlag;
+					covered.insert(kForms.begin(), kForms.end());
+				}
+			}
+
+			entries.emplace_back(kWord, std::move(flags));
+		}
+
+		std::string dictionaryText;
+		std::size_t numEntries = 0;
+		for (const auto &[kStem, kFlags] : entries)
+		{
+			if (!kFlags.empty() || !covered.contains(std::string(kStem)))
+			{
+				dictionaryText += kFlags.empty() ? std::format("{}\n", kStem) : std::format("{}/{}\n", kStem, kFlags);
+				++numEntries;
+			}
+		}
+
+		return { affixText, std::format("{}\n{}", numEntries, dictionaryText) };
+	}
+}
+
+void Lexi::Bench::RunAffixBench(const Options &kOptions)
+{
+	constexpr std::size_t kROUNDS = 20;
+
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	const WordList kMisses = MakeMisses(kWords);
+	const auto [kAffixText, kDictionaryText] = CompressWordList(kWords);
+	const auto kBasePath = std::filesystem::temp_directory_path() / "LexiAffixBench";
+	std::ofstream(std::filesystem::path(kBasePath).replace_extension(".aff")) << kAffixText;
+	std::ofstream(std::filesystem::path(kBasePath).replace_extension(".dic")) << kDictionaryText;
+
+	HashDictionary expanded;
+	double seconds = Measure([&]() { expanded = HashDictionary(kOptions.wordDictPath); });
+	Report("HashDictionary load (expanded)", expanded.VGetSize(), seconds, "word");
+
+	UniqueAffixDictionaryPtr pAffixes;
+	seconds = Measure([&]() { pAffixes = std::make_unique<AffixDictionary>(std::filesystem::path(kBasePath).replace_extension(".dic")); });
+	Report("AffixDictionary load", pAffixes->GetNumStems(), seconds, "stem");
+	std::cout << std::format("  {} words from {} stems & {} rules\n", pAffixes->VGetSize(), pAffixes->GetNumStems(),
+							 pAffixes->GetNumRules());
+	std::cout << std::format("  Memory: {} bytes expanded, {} bytes as stems & rules ({:.1f}%)\n",
+							 expanded.VGetMemoryUsage(), pAffixes->VGetMemoryUsage(),
+							 100.0 * static_cast<double>(pAffixes->VGetMemoryUsage()) /
+							 static_cast<double>(expanded.VGetMemoryUsage()));
+	// Generated forms have to be exactly the word list.
+	std::unordered_set<std::string> generated;
+	pAffixes->VForEachWord([&generated](std::string_view word) { generated.emplace(word); });
+	const std::unordered_set<std::string> kListed(kWords.begin(), kWords.end());
+	const auto kNumAccepted = std::ranges::count_if(kWords, [&](const std::string &kWord) { return pAffixes->VContains(kWord); });
+	const auto kNumFalseHits = std::ranges::count_if(kMisses, [&](const std::string &kMiss)
+	{
+		return pAffixes->VContains(kMiss) != expanded.VContains(kMiss);
+	});
+	std::cout << std::format("  Forms {}, {}/{} words accepted, {} misses disagree with the expanded list\n",
+							 generated == kListed ? "match" : "differ", kNumAccepted, kWords.size(), kNumFalseHits);
+
+	for (const auto &[kName, kpQueries] : { std::pair{ "hits", &kWords }, std::pair{ "misses", &kMisses } })
+	{
+		std::size_t numFound = 0;
+		seconds = Measure([&]()
+		{
+			for (std::size_t round = 0; round < kROUNDS; ++round)
+			{
+				for (const auto &kQuery : *kpQueries)
+				{
+					numFound += expanded.VContains(kQuery);
+				}
+			}
+		});
+		Report(std::format("HashDictionary::VContains, {}", kName), kROUNDS * kpQueries->size(), seconds, "lookup");
+
+		seconds = Measure([&]()
+		{
+			for (std::size_t round = 0; round < kROUNDS; ++round)
+			{
+				for (const auto &kQuery : *kpQueries)
+				{
+					numFound += pAffixes->VContains(kQuery);
+				}
+			}
+		});
+		Report(std::format("AffixDictionary::VContains, {}", kName), kROUNDS * kpQueries->size(), seconds, "lookup");
+		DoNotOptimize(numFound);
+	}
+	// Cross products & case handling on a hand written sample.
+	const AffixDictionary kSample("SET UTF-8\nPFX U Y 1\nPFX U 0 un .\nSFX D Y 2\nSFX D 0 d e\nSFX D 0 ed [^e]\n",
+								  "3\nlock/UD\ntie/D\nParis\n");
+	constexpr std::string_view kSAMPLE_WORDS[] = { "unlocked", "Unlocked", "UNLOCKED", "tied", "PARIS", "Paris" };
+	constexpr std::string_view kSAMPLE_MISSES[] = { "untied", "paris", "lockd", "tieed", "unParis" };
+	std::cout << std::format("  Sample: {}/{} words accepted, {}/{} misses rejected\n",
+							 std::ranges::count_if(kSAMPLE_WORDS, [&](std::string_view word) { return kSample.VContains(word); }),
+							 std::size(kSAMPLE_WORDS),
+							 std::ranges::count_if(kSAMPLE_MISSES, [&](std::string_view word) { return !kSample.VContains(word); }),
+							 std::size(kSAMPLE_MISSES));
+
+	std::filesystem::remove(std::filesystem::path(kBasePath).replace_extension(".aff"));
+	std::filesystem::remove(std::filesystem::path(kBasePath).replace_extension(".dic"));
+}
+
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * @file   ArenaBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Glyph arena against per-glyph heap allocation.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Counts the rows it is shown.
+	class CountingVisitor final : public Lexi::IVisitor
+	{
+	public:
+		std::size_t numBytes = 0;
+		std::size_t numRows = 0;
+
+		void VVisitCharacter(char) override { ++numBytes; }
+		void VVisitRow(void) override { ++numRows; }
+		void VVisitImage(void) override {}
+	};
+
+	//! Fill a row with the characters of a line of text.
+	void FillRow(Lexi::Row &row, std::string_view text, Lexi::CharacterPool &pool, Lexi::StyleId style)
+	{
+		row.Reserve(text.size());
+		while (!text.empty())
+		{
+			const Lexi::Unicode::CodePoint kCodePoint = Lexi::Unicode::Decode(text);
+			row.Append(pool.Get(kCodePoint.value, style));
+			text.remove_prefix(kCodePoint.length);
+		}
+	}
+}
+
+void Lexi::Bench::RunArenaBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 30'000;
+	constexpr std::size_t kNUM_DOCUMENTS = 5;
+	const TextStyle kStyle{ "Monospace", 8, 16 };
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	const std::size_t kNumGlyphs = kRows.size() * kNUM_DOCUMENTS;
+
+	// Every row & child list from the heap, freed one by one on close.
+	double buildSeconds = 0.0;
+	double closeSeconds = 0.0;
+	CountingVisitor heapVisitor;
+	for (std::size_t document = 0; document < kNUM_DOCUMENTS; ++document)
+	{
+		auto pPool = std::make_unique<CharacterPool>();
+		std::vector<UniqueRowPtr> rows;
+		buildSeconds += Measure([&]()
+		{
+			const StyleId kStyleId = pPool->AddStyle(kStyle);
+			rows.reserve(kRows.size());
+			for (const auto &kText : kRows)
+			{
+				FillRow(*rows.emplace_back(LEXI_NEW Row), kText, *pPool, kStyleId);
+			}
+		});
+		for (const auto &kpRow : rows)
+		{
+			kpRow->VAccept(heapVisitor);
+		}
+
+		closeSeconds += Measure([&]()
+		{
+			rows.clear();
+			rows.shrink_to_fit();
+			pPool.reset();
+		});
+	}
+
+	Report("Build, heap rows", kNumGlyphs, buildSeconds, "row");
+	Report("Close, heap rows", kNUM_DOCUMENTS, closeSeconds, "document");
+
+	// Everything in the document's arena, freed at once on close.
+	buildSeconds = 0.0;
+	closeSeconds = 0.0;
+	CountingVisitor arenaVisitor;
+	GlyphArena::Stats stats{};
+	for (std::size_t document = 0; document < kNUM_DOCUMENTS; ++document)
+	{
+		GlyphArena arena;
+		std::optional<CharacterPool> pool;
+		std::pmr::vector<Row *> rows(&arena);
+		buildSeconds += Measure([&]()
+		{
+			pool.emplace(&arena);
+			const StyleId kStyleId = pool->AddStyle(kStyle);
+			rows.reserve(kRows.size());
+			for (const auto &kText : kRows)
+			{
+				FillRow(*rows.emplace_back(&arena.Create<Row>()), kText, *pool, kStyleId);
+			}
+		});
+		for (const Row *pRow : rows)
+		{
+			pRow->VAccept(arenaVisitor);
+		}
+
+		stats = arena.GetStats();
+		closeSeconds += Measure([&]()
+		{
+			// The pool's containers are destroyed first, rows never are.
+			pool.reset();
+			arena.Release();
+		});
+	}
+
+	Report("Build, arena rows", kNumGlyphs, buildSeconds, "row");
+	Report("Close, arena rows", kNUM_DOCUMENTS, closeSeconds, "document");
+	std::cout << std::format("  Arena: {} allocations in {} chunks, {} of {} reserved bytes used, {} deallocations\n",
+							 stats.numAllocations, stats.numChunks, stats.numBytesAllocated, stats.numBytesReserved,
+							 stats.numDeallocations);
+	std::cout << std::format("  Visited bytes {}, rows {}\n",
+							 heapVisitor.numBytes == arenaVisitor.numBytes ? "match" : "differ",
+							 heapVisitor.numRows == arenaVisitor.numRows ? "match" : "differ");
+}
+
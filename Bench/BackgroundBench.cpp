@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file   BackgroundBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Background spell checking benchmark.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Dictionary whose lookups fail, like one that failed to load.
+	class FailingDictionary final : public Lexi::IDictionary
+	{
+	public:
+		bool VContains(std::string_view) const override { LEXI_THROW("Dictionary failed to load."); }
+		void VForEachWord(const WordFunc &) const override {}
+		std::size_t VGetSize(void) const noexcept override { return 0; }
+		std::size_t VGetMemoryUsage(void) const noexcept override { return 0; }
+	};
+}
+
+void Lexi::Bench::RunBackgroundBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 100'000;
+	constexpr std::size_t kNUM_EDITS = 20;
+
+	const HashDictionary kDictionary(kOptions.wordDictPath);
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	std::cout << std::format("  {} rows, {} hardware thread(s)\n", kRows.size(), std::thread::hardware_concurrency());
+
+	BackgroundSpellChecker::MisspellingVector expected;
+	double seconds = Measure([&]()
+	{
+		for (std::size_t rowIndex = 0; rowIndex < kRows.size(); ++rowIndex)
+		{
+			for (const auto &kRange : IncrementalSpellChecker::CheckText(kDictionary, kRows[rowIndex]))
+			{
+				expected.push_back({rowIndex, kRange});
+			}
+		}
+	});
+	Report("Calling thread", kRows.size(), seconds, "row");
+
+	std::vector<std::size_t> threadCounts{1, 2, 4};
+	if (std::thread::hardware_concurrency() > 4)
+	{
+		threadCounts.push_back(std::thread::hardware_concurrency());
+	}
+
+	for (const std::size_t kNumThreads : threadCounts)
+	{
+		ThreadPool threadPool(kNumThreads);
+		BackgroundSpellChecker checker(kDictionary, threadPool);
+		double startSeconds = 0.0;
+		seconds = Measure([&]()
+		{
+			startSeconds = Measure([&]() { checker.Start(kRows); });
+			checker.Wait();
+		});
+		Report(std::format("Pool, {} thread(s)", kNumThreads), kRows.size(), seconds, "row");
+		std::cout << std::format("  Start() took {:.3f} ms on the calling thread, results {}\n",
+								 startSeconds * 1000.0, checker.GetMisspellings() == expected ? "match" : "differ");
+	}
+	// Editing mid-pass: each edit restarts the check, only the last pass has to complete.
+	ThreadPool threadPool;
+	BackgroundSpellChecker checker(kDictionary, threadPool);
+	seconds = Measure([&]()
+	{
+		for (std::size_t edit = 0; edit < kNUM_EDITS; ++edit)
+		{
+			checker.Start(kRows);
+		}
+		checker.Wait();
+	});
+	Report("Restarted passes", kNUM_EDITS, seconds, "edit");
+	std::cout << std::format("  {} passes started, last pass {}\n", checker.GetGeneration(),
+							 checker.GetMisspellings() == expected ? "matches" : "differs");
+	// A failing lookup ends the pass, the error surfaces in Wait().
+	const FailingDictionary kFailing;
+	BackgroundSpellChecker failingChecker(kFailing, threadPool);
+	failingChecker.Start(kRows);
+	bool bRethrown = false;
+	try
+	{
+		failingChecker.Wait();
+	}
+	catch (const std::exception &)
+	{
+		bRethrown = true;
+	}
+	std::cout << std::format("  Failing dictionary: pass {}, error {}\n", failingChecker.IsDone() ? "ended" : "hangs",
+							 bRethrown ? "rethrown" : "lost");
+}
+
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * @file   Bench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Micro-benchmark harness.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+void Lexi::Bench::Report(std::string_view name, std::size_t numOps, double seconds, std::string_view unit)
+{
+	const double kRate = (seconds > 0.0) ? (static_cast<double>(numOps) / seconds) : 0.0;
+	std::cout << std::format("  {:<40} {:>12} {:<6} {:>10.3f} ms {:>16.0f} {}/s\n",
+							 name, numOps, unit, seconds * 1000.0, kRate, unit);
+}
+
+void Lexi::Bench::ReportBytes(std::string_view name, std::size_t numBytes, double seconds)
+{
+	const double kRate = (seconds > 0.0) ? (static_cast<double>(numBytes) / seconds / 1.0e6) : 0.0;
+	std::cout << std::format("  {:<40} {:>12} {:<6} {:>10.3f} ms {:>16.1f} MB/s\n",
+							 name, numBytes, "bytes", seconds * 1000.0, kRate);
+}
+
+Lexi::Bench::WordList Lexi::Bench::LoadWordList(const std::filesystem::path &kPath)
+{
+	std::ifstream inFile(kPath);
+	LEXI_THROW_IF(!inFile, "Couldn't open the benchmark word list!");
+
+	WordList words;
+	for (std::string word; inFile >> word; )
+	{
+		words.push_back(std::move(word));
+	}
+
+	return words;
+}
+
+Lexi::Bench::WordList Lexi::Bench::MakeMisses(const WordList &kWords)
+{
+	WordList misses;
+	misses.reserve(kWords.size());
+	for (const auto &kWord : kWords)
+	{
+		std::string miss = kWord;
+		miss.insert(miss.size() / 2, "zq");
+		misses.push_back(std::move(miss));
+	}
+
+	return misses;
+}
+
+Lexi::Bench::WordList Lexi::Bench::MakeRows(const WordList &kWords, std::size_t numRows, std::size_t rowWidth,
+											unsigned seed)
+{
+	constexpr std::string_view kSEPARATORS[] = { " ", " ", " ", " ", ", ", ". ", "; ", " (", ") " };
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<std::size_t> wordDist(0, kWords.size() - 1);
+	std::uniform_int_distribution<std::size_t> sepDist(0, std::size(kSEPARATORS) - 1);
+
+	WordList rows(numRows);
+	for (auto &row : rows)
+	{
+		while (row.size() < rowWidth)
+		{
+			std::string word = kWords[wordDist(rng)];
+			if (rng() % 30 == 0)
+			{
+				word.insert(word.size() / 2, "zq");
+			}
+
+			row += word;
+			row += kSEPARATORS[sepDist(rng)];
+		}
+	}
+
+	return rows;
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * @file   Bench.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Micro-benchmark harness.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_BENCH_HPP
+#define LEXI_BENCH_HPP
+
+//! Benchmark namespace.
+namespace Lexi::Bench
+{
+	using Clock = std::chrono::steady_clock;
+	using WordList = std::vector<std::string>;
+	//! Options shared by every suite.
+	struct Options
+	{
+		std::filesystem::path wordDictPath; //!< Word list used as input data
+	};
+	//! Benchmark suite entry.
+	struct Suite
+	{
+		std::string_view name;
+		std::string_view description;
+		void (*pRun)(const Options &kOptions);
+	};
+
+	//! Time a callable, returns elapsed seconds.
+	template <typename Func>
+	double Measure(Func &&func);
+	//! Prevent the optimizer from discarding a computed value.
+	template <typename T>
+	void DoNotOptimize(const T &kValue);
+	//! Print a throughput line for a measured run.
+	void Report(std::string_view name, std::size_t numOps, double seconds, std::string_view unit = "ops");
+	//! Print a throughput line in MB/s for a measured run over numBytes of input.
+	void ReportBytes(std::string_view name, std::size_t numBytes, double seconds);
+	//! Load a word list with one word per line.
+	WordList LoadWordList(const std::filesystem::path &kPath);
+	//! Build words that are unlikely to be in the list by mangling every word.
+	WordList MakeMisses(const WordList &kWords);
+	/**
+	 * Generate document rows of about rowWidth characters.
+	 *
+	 * Words are drawn from kWords with some punctuation, and roughly one word
+	 * in thirty is mangled so the text contains misspellings.
+	 */
+	WordList MakeRows(const WordList &kWords, std::size_t numRows, std::size_t rowWidth = 72, unsigned seed = 1);
+
+	template <typename Func>
+	inline double Measure(Func &&func)
+	{
+		const auto kStart = Clock::now();
+		func();
+		return std::chrono::duration<double>(Clock::now() - kStart).count();
+	}
+
+	template <typename T>
+	inline void DoNotOptimize(const T &kValue)
+	{
+		asm volatile("" : : "r,m"(kValue) : "memory");
+	}
+	// Suites (see *Bench.cpp):
+	void RunDictionaryBench(const Options &kOptions);
+	void RunSuggestionBench(const Options &kOptions);
+	void RunIncrementalBench(const Options &kOptions);
+	void RunBackgroundBench(const Options &kOptions);
+	void RunVisitorBench(const Options &kOptions);
+	void RunStringBench(const Options &kOptions);
+	void RunRegistryBench(const Options &kOptions);
+	void RunReloadBench(const Options &kOptions);
+	void RunUnicodeBench(const Options &kOptions);
+	void RunAffixBench(const Options &kOptions);
+	void RunGlyphBench(const Options &kOptions);
+	void RunPieceTableBench(const Options &kOptions);
+	void RunArenaBench(const Options &kOptions);
+	void RunBlockBench(const Options &kOptions);
+	void RunStaticVisitorBench(const Options &kOptions);
+	void RunFusedVisitorBench(const Options &kOptions);
+	void RunCompositionBench(const Options &kOptions);
+	void RunParallelLayoutBench(const Options &kOptions);
+} // End namespace (Lexi::Bench)
+
+#endif /* !LEXI_BENCH_HPP */
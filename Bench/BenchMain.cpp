@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * @file   BenchMain.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Benchmark entry point.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+using namespace Lexi;
+
+static constexpr Bench::Suite kSUITES[] = {
+	{ "dictionary", "Dictionary lookups per second.", Bench::RunDictionaryBench },
+	{ "suggest", "Spelling suggestion latency.", Bench::RunSuggestionBench },
+	{ "incremental", "Per-keystroke cost of incremental spell checking.", Bench::RunIncrementalBench },
+	{ "background", "Whole-document spell checking on the thread pool.", Bench::RunBackgroundBench },
+	{ "visitor", "Per-character vs bulk text visiting.", Bench::RunVisitorBench },
+	{ "strings", "SIMD string helpers against the scalar reference.", Bench::RunStringBench },
+	{ "registry", "Per-visitor dictionary loading vs the shared registry.", Bench::RunRegistryBench },
+	{ "reload", "Lookups while dictionaries are swapped & reloaded.", Bench::RunReloadBench },
+	{ "unicode", "UTF-8 tokenizing on ASCII & mixed-script text.", Bench::RunUnicodeBench },
+	{ "affix", "Stems & affix rules against the fully expanded word list.", Bench::RunAffixBench },
+	{ "glyphs", "Flyweight characters against one heap object per character.", Bench::RunGlyphBench },
+	{ "piecetable", "Piece table edits, undo & traversal against a flat string.", Bench::RunPieceTableBench },
+	{ "arena", "Glyph arena against per-glyph heap allocation & teardown.", Bench::RunArenaBench },
+	{ "blocks", "Structure-of-arrays glyph blocks against the glyph tree.", Bench::RunBlockBench },
+	{ "static", "Static (CRTP) against virtual visitor dispatch over the glyph tree.", Bench::RunStaticVisitorBench },
+	{ "fused", "Several analyses fused into one traversal against one pass each.", Bench::RunFusedVisitorBench },
+	{ "compose", "Greedy & Knuth-Plass line breaking, full & per keystroke.", Bench::RunCompositionBench },
+	{ "layout", "Parallel paragraph layout from 1 to N threads.", Bench::RunParallelLayoutBench },
+};
+
+int main(int numArgs, char *pArgs[]) try
+{
+	Bench::Options options{ "Words.txt" };
+	std::vector<std::string_view> suiteNames;
+
+	for (int index = 1; index < numArgs; ++index)
+	{
+		const std::string_view kArg = pArgs[index];
+		if (kArg == "--dict" && (index + 1) < numArgs)
+		{
+			options.wordDictPath = pArgs[++index];
+		}
+		else if (kArg == "--list")
+		{
+			for (const auto &kSuite : kSUITES)
+			{
+				std::cout << std::format("{:<16} {}\n", kSuite.name, kSuite.description);
+			}
+			return 0;
+		}
+		else
+		{
+			suiteNames.push_back(kArg);
+		}
+	}
+
+	for (const auto &kSuite : kSUITES)
+	{
+		if (!suiteNames.empty() && std::ranges::find(suiteNames, kSuite.name) == suiteNames.end())
+		{
+			continue;
+		}
+
+		std::cout << std::format("[{}] {}\n", kSuite.name, kSuite.description);
+		kSuite.pRun(options);
+	}
+
+	return 0;
+}
+catch (const Exception &kExcept)
+{
+	LEXI_ERR("Exception occured({}:{}): {}", kExcept.GetFilename(), kExcept.GetLineNum(), kExcept.VWhat());
+	return 1;
+}
+catch (const std::exception &kExcept)
+{
+	LEXI_ERR("Exception occured: {}", kExcept.what());
+	return 1;
+}
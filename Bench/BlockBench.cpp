@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * @file   BlockBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Structure-of-arrays glyph blocks against the glyph tree.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Counts text bytes & rows, taking runs of text whole.
+	class CountingVisitor final : public Lexi::IVisitor
+	{
+	public:
+		std::size_t numBytes = 0;
+		std::size_t numRows = 0;
+
+		void VVisitCharacter(char) override { ++numBytes; }
+		void VVisitText(std::span<const char> text) override { numBytes += text.size(); }
+		void VVisitRow(void) override { ++numRows; }
+		void VVisitImage(void) override {}
+	};
+
+	//! Sums character positions, reading a block's position array directly.
+	class PositionVisitor final : public Lexi::IVisitor
+	{
+	public:
+		std::int64_t checksum = 0;
+
+		void VVisitCharacter(char) override {}
+		void VVisitRow(void) override {}
+		void VVisitImage(void) override {}
+		void VVisitBlock(const Lexi::GlyphBlock &kBlock) override
+		{
+			for (const std::int32_t kX : kBlock.GetXs())
+			{
+				checksum += kX;
+			}
+		}
+	};
+}
+
+void Lexi::Bench::RunBlockBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 100'000;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, 16 });
+	std::size_t numBytes = 0;
+	for (const auto &kRow : kRows)
+	{
+		numBytes += kRow.size();
+	}
+	// Pointer tree: rows of pooled characters.
+	std::vector<Row> rows;
+	double seconds = Measure([&]()
+	{
+		rows.reserve(kRows.size());
+		for (const auto &kText : kRows)
+		{
+			Row &row = rows.emplace_back();
+			row.Reserve(kText.size());
+			for (std::string_view text = kText; !text.empty(); )
+			{
+				const Unicode::CodePoint kCodePoint = Unicode::Decode(text);
+				row.Append(pool.Get(kCodePoint.value, kStyle));
+				text.remove_prefix(kCodePoint.length);
+			}
+		}
+	});
+	Report("Build, glyph tree", kRows.size(), seconds, "row");
+
+	std::vector<GlyphBlock> blocks;
+	seconds = Measure([&]()
+	{
+		for (std::size_t first = 0; first < kRows.size(); first += GlyphBlock::kMAX_ROWS)
+		{
+			const auto kBlockRows = std::span(kRows).subspan(first, std::min(GlyphBlock::kMAX_ROWS, kRows.size() - first));
+			std::size_t numBlockBytes = 0;
+			for (const auto &kText : kBlockRows)
+			{
+				numBlockBytes += kText.size();
+			}
+
+			GlyphBlock &block = blocks.emplace_back();
+			block.Reserve(numBlockBytes, numBlockBytes);
+			for (const auto &kText : kBlockRows)
+			{
+				block.AppendRow(kText, kStyle, pool);
+			}
+		}
+	});
+	Report("Build, glyph blocks", kRows.size(), seconds, "row");
+
+	std::size_t treeBytes = rows.capacity() * sizeof(Row);
+	for (const Row &kRow : rows)
+	{
+		treeBytes += kRow.GetMemoryUsage() - sizeof(Row);
+	}
+
+	std::size_t blockBytes = blocks.capacity() * sizeof(GlyphBlock);
+	for (const GlyphBlock &kBlock : blocks)
+	{
+		blockBytes += kBlock.GetMemoryUsage() - sizeof(GlyphBlock);
+	}
+
+	std::cout << std::format("  {} blocks; {:.2f} bytes per character in the tree, {:.2f} in blocks\n", blocks.size(),
+							 static_cast<double>(treeBytes) / static_cast<double>(numBytes),
+							 static_cast<double>(blockBytes) / static_cast<double>(numBytes));
+
+	// Text traversal.
+	CountingVisitor treeCounter;
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.VAccept(treeCounter);
+		}
+	});
+	ReportBytes("Visit text, glyph tree", numBytes, seconds);
+
+	CountingVisitor blockCounter;
+	seconds = Measure([&]()
+	{
+		for (const GlyphBlock &kBlock : blocks)
+		{
+			kBlock.Accept(blockCounter);
+		}
+	});
+	ReportBytes("Visit text, glyph blocks", numBytes, seconds);
+
+	// Position traversal.
+	std::int64_t treeChecksum = 0;
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.ForEachChild(Point{}, [&treeChecksum](const IGlyph &, Point position) { treeChecksum += position.x; });
+		}
+	});
+	ReportBytes("Visit positions, glyph tree", numBytes, seconds);
+
+	PositionVisitor positionVisitor;
+	seconds = Measure([&]()
+	{
+		for (const GlyphBlock &kBlock : blocks)
+		{
+			kBlock.Accept(positionVisitor);
+		}
+	});
+	ReportBytes("Visit positions, glyph blocks", numBytes, seconds);
+
+	// Spell checking the document.
+	auto pDictionary = std::make_shared<HashDictionary>(kOptions.wordDictPath);
+	SpellCheckVisitor treeChecker(pDictionary);
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.VAccept(treeChecker);
+		}
+	});
+	ReportBytes("Spell check, glyph tree", numBytes, seconds);
+
+	SpellCheckVisitor blockChecker(pDictionary);
+	seconds = Measure([&]()
+	{
+		for (const GlyphBlock &kBlock : blocks)
+		{
+			kBlock.Accept(blockChecker);
+		}
+	});
+	ReportBytes("Spell check, glyph blocks", numBytes, seconds);
+
+	const bool kbTextMatches = treeCounter.numBytes == blockCounter.numBytes && treeCounter.numRows == blockCounter.numRows;
+	std::cout << std::format("  Text {}, positions {}, {} misspellings {}\n", kbTextMatches ? "matches" : "differs",
+							 treeChecksum == positionVisitor.checksum ? "match" : "differ",
+							 blockChecker.GetMisspellings().size(),
+							 treeChecker.GetMisspellings() == blockChecker.GetMisspellings() ? "match" : "differ");
+}
+
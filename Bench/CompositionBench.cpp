@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * @file   CompositionBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Line breaking & incremental relayout benchmarks.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+namespace
+{
+	//! Row positions & lengths of a whole composition, to compare layouts.
+	std::vector<std::pair<std::int32_t, std::size_t>> GetLayout(const Lexi::Composition &kComposition)
+	{
+		std::vector<std::pair<std::int32_t, std::size_t>> layout;
+		kComposition.ForEachRow(0, kComposition.GetHeight(), [&layout](const Lexi::Row &kRow, Lexi::Point origin)
+		{
+			layout.emplace_back(origin.y, kRow.GetNumChildren());
+		});
+		return layout;
+	}
+}
+
+void Lexi::Bench::RunCompositionBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_PARAGRAPHS = 5'000;
+	constexpr std::size_t kROWS_PER_PARAGRAPH = 8;
+	constexpr std::size_t kNUM_EDITS = 2'000;
+	constexpr std::int32_t kLINE_WIDTH = 480;
+	constexpr std::int32_t kPAGE_HEIGHT = 1'000;
+	constexpr std::int32_t kLINE_HEIGHT = 16;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_PARAGRAPHS * kROWS_PER_PARAGRAPH);
+	std::string text;
+	for (std::size_t index = 0; index < kRows.size(); ++index)
+	{
+		text += kRows[index];
+		text += ((index + 1) % kROWS_PER_PARAGRAPH == 0) ? '\n' : ' ';
+	}
+
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, kLINE_HEIGHT });
+	const auto kMakeCompositor = [](bool bTeX) -> UniqueICompositorPtr
+	{
+		return bTeX ? UniqueICompositorPtr(std::make_unique<TeXCompositor>()) : std::make_unique<SimpleCompositor>();
+	};
+
+	for (const bool kbTeX : { false, true })
+	{
+		// Whole document.
+		Composition composition(kMakeCompositor(kbTeX), kLINE_WIDTH, kPAGE_HEIGHT, kLINE_HEIGHT);
+		composition.Assign(text, pool, kStyle);
+		double seconds = Measure([&]() { composition.Compose(); });
+		const std::string_view kName = composition.GetCompositor().VGetName();
+		Report(std::format("{}: full layout", kName), composition.GetNumParagraphs(), seconds, "paragraph");
+		std::cout << std::format("  {} rows on {} pages\n", composition.GetStats().numRowsBuilt, composition.GetNumPages());
+
+		// Keystrokes at random places, composing after each one.
+		std::mt19937 random(5);
+		const Composition::Stats kBefore = composition.GetStats();
+		std::vector<double> editSeconds;
+		editSeconds.reserve(kNUM_EDITS);
+		for (std::size_t edit = 0; edit < kNUM_EDITS; ++edit)
+		{
+			const std::size_t kParagraph = random() % composition.GetNumParagraphs();
+			const std::size_t kNumGlyphs = composition.GetGlyphs(kParagraph).size();
+			if (random() % 4 == 0 && kNumGlyphs > 0)
+			{
+				composition.EraseGlyph(kParagraph, random() % kNumGlyphs);
+			}
+			else
+			{
+				const char32_t kCodePoint = (random() % 6 == 0) ? U' ' : U'a' + static_cast<char32_t>(random() % 26);
+				composition.InsertGlyph(kParagraph, random() % (kNumGlyphs + 1), pool.Get(kCodePoint, kStyle));
+			}
+
+			composition.Compose();
+			editSeconds.push_back(composition.GetStats().lastPassSeconds);
+		}
+
+		const Composition::Stats &kAfter = composition.GetStats();
+		std::ranges::sort(editSeconds);
+		Report(std::format("{}: keystroke relayout", kName), kNUM_EDITS, kAfter.totalPassSeconds - kBefore.totalPassSeconds,
+			   "edit");
+		std::cout << std::format("  Per edit: median {:.1f} us, 99th percentile {:.1f} us, max {:.1f} us; "
+								 "{:.2f} paragraphs composed & {:.1f} moved on average\n",
+								 editSeconds[editSeconds.size() / 2] * 1e6, editSeconds[editSeconds.size() * 99 / 100] * 1e6,
+								 editSeconds.back() * 1e6,
+								 static_cast<double>(kAfter.numParagraphsComposed - kBefore.numParagraphsComposed) / kNUM_EDITS,
+								 static_cast<double>(kAfter.numParagraphsMoved - kBefore.numParagraphsMoved) / kNUM_EDITS);
+
+		// The incremental layout must match laying out the edited document from scratch.
+		Composition fresh(kMakeCompositor(kbTeX), kLINE_WIDTH, kPAGE_HEIGHT, kLINE_HEIGHT);
+		for (std::size_t paragraph = 0; paragraph < composition.GetNumParagraphs(); ++paragraph)
+		{
+			fresh.InsertParagraph(paragraph, composition.GetGlyphs(paragraph));
+		}
+
+		seconds = Measure([&]() { fresh.Compose(); });
+		Report(std::format("{}: full relayout", kName), 1, seconds, "edit");
+		std::cout << std::format("  Incremental layout {} a full relayout\n",
+								 GetLayout(composition) == GetLayout(fresh) ? "matches" : "differs from");
+
+		// Rows are rebuilt in the memory of the ones they replace, so relayouts don't grow the arenas.
+		const std::size_t kEditedBytes = composition.GetRowMemoryStats().numBytesReserved;
+		const std::size_t kFreshBytes = fresh.GetRowMemoryStats().numBytesReserved;
+		for (std::size_t resize = 0; resize < 10; ++resize)
+		{
+			fresh.SetLineWidth((resize % 2 == 0) ? kLINE_WIDTH / 2 : kLINE_WIDTH);
+			fresh.Compose();
+		}
+
+		std::cout << std::format("  Row arenas: {} KiB after the edits, {} KiB fresh, {} KiB after 10 resizes\n",
+								 kEditedBytes / 1024, kFreshBytes / 1024, fresh.GetRowMemoryStats().numBytesReserved / 1024);
+	}
+}
+
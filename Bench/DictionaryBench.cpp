@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * @file   DictionaryBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Dictionary lookup benchmarks.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+void Lexi::Bench::RunDictionaryBench(const Options &kOptions)
+{
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	const WordList kMisses = MakeMisses(kWords);
+	// The linear scan is quadratic, so it only gets a sample of the queries.
+	constexpr std::size_t kLINEAR_SAMPLE = 2000;
+	constexpr std::size_t kROUNDS = 20;
+	std::size_t numFound = 0;
+
+	double seconds = Measure([&]()
+	{
+		for (std::size_t index = 0; index < kLINEAR_SAMPLE; ++index)
+		{
+			const auto &kQuery = (index % 2 == 0) ? kWords[index * 7 % kWords.size()] : kMisses[index * 7 % kMisses.size()];
+			numFound += (std::ranges::find(kWords, kQuery) != kWords.end());
+		}
+	});
+	Report("std::ranges::find (before)", kLINEAR_SAMPLE, seconds, "lookup");
+
+	HashDictionary dictionary;
+	seconds = Measure([&]() { dictionary = HashDictionary(kOptions.wordDictPath); });
+	Report("HashDictionary load (text)", dictionary.VGetSize(), seconds, "word");
+
+	const auto kCompiledPath = std::filesystem::temp_directory_path() / "LexiBench.ldict";
+	dictionary.SaveBinary(kCompiledPath);
+	HashDictionary compiled;
+	seconds = Measure([&]() { compiled = HashDictionary(kCompiledPath); });
+	Report("HashDictionary load (compiled)", compiled.VGetSize(), seconds, "word");
+
+	seconds = Measure([&]()
+	{
+		for (std::size_t round = 0; round < kROUNDS; ++round)
+		{
+			for (std::size_t index = 0; index < kWords.size(); ++index)
+			{
+				numFound += dictionary.VContains(kWords[index]);
+				numFound += dictionary.VContains(kMisses[index]);
+			}
+		}
+	});
+	Report("HashDictionary::VContains (after)", kROUNDS * kWords.size() * 2, seconds, "lookup");
+
+	seconds = Measure([&]()
+	{
+		for (std::size_t round = 0; round < kROUNDS; ++round)
+		{
+			for (std::size_t index = 0; index < kWords.size(); ++index)
+			{
+				numFound += compiled.VContains(kWords[index]);
+				numFound += compiled.VContains(kMisses[index]);
+			}
+		}
+	});
+	Report("HashDictionary::VContains (compiled)", kROUNDS * kWords.size() * 2, seconds, "lookup");
+	std::filesystem::remove(kCompiledPath);
+
+	DawgDictionary dawg;
+	seconds = Measure([&]() { dawg = DawgDictionary(kOptions.wordDictPath); });
+	Report("DawgDictionary build", dawg.VGetSize(), seconds, "word");
+
+	seconds = Measure([&]()
+	{
+		for (std::size_t round = 0; round < kROUNDS; ++round)
+		{
+			for (std::size_t index = 0; index < kWords.size(); ++index)
+			{
+				numFound += dawg.VContains(kWords[index]);
+				numFound += dawg.VContains(kMisses[index]);
+			}
+		}
+	});
+	Report("DawgDictionary::VContains", kROUNDS * kWords.size() * 2, seconds, "lookup");
+
+	std::size_t numCompletions = 0;
+	seconds = Measure([&]()
+	{
+		for (std::size_t index = 0; index < kWords.size(); index += 16)
+		{
+			dawg.ForEachWithPrefix(std::string_view(kWords[index]).substr(0, 3), [&](std::string_view)
+			{
+				++numCompletions;
+				return true;
+			});
+		}
+	});
+	Report("DawgDictionary::ForEachWithPrefix", numCompletions, seconds, "word");
+
+	// Misses dominate the cost of unfiltered lookups, so compare on misses only.
+	for (const bool kbDawg : { false, true })
+	{
+		UniqueIDictionaryPtr pInner = kbDawg ? UniqueIDictionaryPtr(std::make_unique<DawgDictionary>(kWords))
+											 : UniqueIDictionaryPtr(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+		const IDictionary &kInner = *pInner;
+		seconds = Measure([&]()
+		{
+			for (std::size_t round = 0; round < kROUNDS; ++round)
+			{
+				for (const auto &kMiss : kMisses)
+				{
+					numFound += kInner.VContains(kMiss);
+				}
+			}
+		});
+		Report(kbDawg ? "DawgDictionary misses" : "HashDictionary misses", kROUNDS * kMisses.size(), seconds, "lookup");
+
+		const FilteredDictionary kFiltered(std::move(pInner));
+		seconds = Measure([&]()
+		{
+			for (std::size_t round = 0; round < kROUNDS; ++round)
+			{
+				for (const auto &kMiss : kMisses)
+				{
+					numFound += kFiltered.VContains(kMiss);
+				}
+			}
+		});
+		Report("  + Bloom filter", kROUNDS * kMisses.size(), seconds, "lookup");
+
+		const auto kStats = kFiltered.GetStats();
+		std::cout << std::format("    filter hit rate {:.2f}%, false positive rate {:.2f}%, {} filter bytes\n",
+								 kStats.GetHitRate() * 100.0, kStats.GetFalsePositiveRate() * 100.0,
+								 kFiltered.VGetMemoryUsage() - kFiltered.GetDictionary().VGetMemoryUsage());
+	}
+
+	DoNotOptimize(numFound);
+	// Estimate the old layout: string objects plus heap blocks for words that
+	// do not fit the small-string buffer.
+	std::size_t vectorBytes = sizeof(kWords) + kWords.capacity() * sizeof(std::string);
+	for (const auto &kWord : kWords)
+	{
+		vectorBytes += (kWord.capacity() > std::string().capacity()) ? (kWord.capacity() + 1 + 2 * sizeof(void *)) : 0;
+	}
+
+	auto reportMemory = [&kWords](std::string_view name, std::size_t numBytes)
+	{
+		std::cout << std::format("  {:<40} {:>12} bytes {:>8.2f} bytes/word\n", name, numBytes,
+								 static_cast<double>(numBytes) / static_cast<double>(kWords.size()));
+	};
+	reportMemory("std::vector<std::string> (estimate)", vectorBytes);
+	reportMemory("HashDictionary", dictionary.VGetMemoryUsage());
+	reportMemory("DawgDictionary", dawg.VGetMemoryUsage());
+	std::cout << std::format("  {} slots, {} graph edges\n", dictionary.GetCapacity(), dawg.GetNumEdges());
+}
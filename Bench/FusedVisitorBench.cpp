@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * @file   FusedVisitorBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Fused against separate visitor passes.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Needs rows only, like pagination would.
+	class RowCountVisitor final : public Lexi::StaticVisitor<RowCountVisitor>
+	{
+	public:
+		static constexpr Lexi::GlyphKindMask kGLYPH_KINDS = Lexi::kGLYPH_KIND_MASK<Lexi::GlyphKind::kRow>;
+		std::size_t numRows = 0;
+		std::size_t numCharacters = 0; //!< Characters it was handed anyway
+
+		void VisitCharacter(char) { ++numCharacters; }
+		void VisitRow(void) { ++numRows; }
+	};
+
+	//! Fails on any text, like a spell checker whose dictionary failed to load.
+	class FailingVisitor final : public Lexi::StaticVisitor<FailingVisitor>
+	{
+	public:
+		void VisitCharacter(char) { LEXI_THROW("Dictionary failed to load."); }
+		void VisitRow(void) {}
+	};
+
+	//! Results of one set of analyses, to compare separate & fused passes.
+	struct Analyses
+	{
+		Lexi::SpellCheckVisitor spellChecker;
+		Lexi::WordCountVisitor wordCounter;
+		RowCountVisitor rowCounter;
+
+		explicit Analyses(Lexi::DictionaryHandle pDictionary)
+			: spellChecker(std::move(pDictionary)), wordCounter{}, rowCounter{}
+		{
+		}
+
+		bool operator==(const Analyses &kOther) const
+		{
+			return spellChecker.GetMisspellings() == kOther.spellChecker.GetMisspellings() &&
+				   wordCounter.GetCounts() == kOther.wordCounter.GetCounts() &&
+				   rowCounter.numRows == kOther.rowCounter.numRows &&
+				   rowCounter.numCharacters == kOther.rowCounter.numCharacters;
+		}
+	};
+
+	//! Time the analyses as three traversals & as one fused traversal of the same document.
+	template <typename Traverse>
+	void CompareFusion(std::string_view name, std::size_t numBytes, Lexi::DictionaryHandle pDictionary, Traverse &&traverse)
+	{
+		Analyses separate(pDictionary);
+		double seconds = Lexi::Bench::Measure([&]()
+		{
+			traverse(separate.spellChecker);
+			traverse(separate.wordCounter);
+			traverse(separate.rowCounter);
+		});
+		Lexi::Bench::ReportBytes(std::format("{}: 3 separate passes", name), numBytes, seconds);
+
+		Analyses fused(pDictionary);
+		seconds = Lexi::Bench::Measure([&]()
+		{
+			Lexi::FusedVisitor visitor(fused.spellChecker, fused.wordCounter, fused.rowCounter);
+			traverse(visitor);
+			visitor.Flush();
+		});
+		Lexi::Bench::ReportBytes(std::format("{}: 1 fused pass", name), numBytes, seconds);
+		std::cout << std::format("  {} words, {} misspellings, results {}\n", fused.wordCounter.GetCounts().numWords,
+								 fused.spellChecker.GetMisspellings().size(), separate == fused ? "match" : "differ");
+	}
+}
+
+void Lexi::Bench::RunFusedVisitorBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 100'000;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	const DictionaryHandle kpDictionary = std::make_shared<HashDictionary>(kOptions.wordDictPath);
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, 16 });
+	std::vector<Row> rows;
+	std::vector<GlyphBlock> blocks;
+	std::string text;
+	rows.reserve(kRows.size());
+	for (const auto &kText : kRows)
+	{
+		Row &row = rows.emplace_back();
+		row.Reserve(kText.size());
+		for (std::string_view rest = kText; !rest.empty(); )
+		{
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(rest);
+			row.Append(pool.Get(kCodePoint.value, kStyle));
+			rest.remove_prefix(kCodePoint.length);
+		}
+
+		if (blocks.empty() || blocks.back().IsFull())
+		{
+			blocks.emplace_back();
+		}
+
+		blocks.back().AppendRow(kText, kStyle, pool);
+		text.append(kText).push_back('\n');
+	}
+
+	const PieceTable kTable = PieceTable::FromText(text);
+	const std::size_t kNumBytes = text.size() - kRows.size();
+
+	CompareFusion("Glyph tree", kNumBytes, kpDictionary, [&rows](auto &visitor)
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.Accept(visitor);
+		}
+	});
+	CompareFusion("Glyph blocks", kNumBytes, kpDictionary, [&blocks](auto &visitor)
+	{
+		for (const GlyphBlock &kBlock : blocks)
+		{
+			kBlock.Accept(visitor);
+		}
+	});
+	// The piece table has no rows, only newlines.
+	CompareFusion("Piece table", text.size(), kpDictionary, [&kTable](auto &visitor) { kTable.Accept(visitor); });
+
+	RowCountVisitor rowCounter;
+	const double kSeconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.Accept(rowCounter);
+		}
+	});
+	ReportBytes("Glyph tree: rows only", kNumBytes, kSeconds);
+
+	// Pending text a visitor fails on is logged by the destructor, not thrown (which would terminate).
+	FailingVisitor failing;
+	{
+		FusedVisitor visitor(failing, rowCounter);
+		visitor.VisitCharacter('a');
+	}
+	std::cout << "  Destroyed a fused visitor with a failing flush\n";
+}
+
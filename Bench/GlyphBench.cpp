@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * @file   GlyphBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Flyweight characters against one heap object per character.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+	//! What every character costs without sharing: intrinsic & extrinsic state in its own heap object.
+	class NaiveCharacter final : public Lexi::IGlyph
+	{
+	public:
+		char32_t codePoint;
+		Lexi::StyleId style;
+		Lexi::Point position;
+		std::int32_t width;
+		std::int32_t height;
+
+		NaiveCharacter(char32_t codePoint, Lexi::StyleId style, Lexi::Point position, std::int32_t width,
+					   std::int32_t height) noexcept
+			: codePoint(codePoint), style(style), position(position), width(width), height(height)
+		{
+		}
+
+		void VAccept(Lexi::IVisitor &visitor) const override
+		{
+			char bytes[Lexi::Unicode::kMAX_SEQUENCE_LENGTH];
+			const std::size_t kLength = Lexi::Unicode::Encode(codePoint, bytes);
+			for (std::size_t index = 0; index < kLength; ++index)
+			{
+				visitor.VVisitCharacter(bytes[index]);
+			}
+		}
+
+		std::int32_t VGetWidth(void) const noexcept override { return width; }
+		std::int32_t VGetHeight(void) const noexcept override { return height; }
+	};
+
+	//! Counts what it is shown.
+	class CountingVisitor final : public Lexi::IVisitor
+	{
+	public:
+		std::size_t numBytes = 0;
+		std::size_t numRows = 0;
+
+		void VVisitCharacter(char) override { ++numBytes; }
+		void VVisitRow(void) override { ++numRows; }
+		void VVisitImage(void) override {}
+	};
+
+	//! Heap bytes currently allocated (zero where glibc's allocator statistics are unavailable).
+	std::size_t GetHeapUsage(void)
+	{
+#if defined(__GLIBC__)
+		return mallinfo2().uordblks;
+#else
+		return 0;
+#endif
+	}
+}
+
+void Lexi::Bench::RunGlyphBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 30'000;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	std::size_t numCharacters = 0;
+	for (const auto &kRow : kRows)
+	{
+		numCharacters += Unicode::CountCodePoints(kRow);
+	}
+	// Flyweights: the rows only reference pooled characters.
+	std::size_t heapStart = GetHeapUsage();
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, 16 });
+	std::vector<Row> rows;
+	double seconds = Measure([&]()
+	{
+		rows.reserve(kRows.size());
+		for (const auto &kText : kRows)
+		{
+			Row &row = rows.emplace_back();
+			row.Reserve(kText.size());
+			for (std::string_view text = kText; !text.empty(); )
+			{
+				const Unicode::CodePoint kCodePoint = Unicode::Decode(text);
+				row.Append(pool.Get(kCodePoint.value, kStyle));
+				text.remove_prefix(kCodePoint.length);
+			}
+		}
+	});
+	const std::size_t kFlyweightHeap = GetHeapUsage() - heapStart;
+	Report("Build rows, flyweight characters", numCharacters, seconds, "char");
+
+	// One heap object per character, positioned when it is created.
+	heapStart = GetHeapUsage();
+	std::vector<std::vector<std::unique_ptr<NaiveCharacter>>> naiveRows;
+	seconds = Measure([&]()
+	{
+		naiveRows.reserve(kRows.size());
+		std::int32_t y = 0;
+		for (const auto &kText : kRows)
+		{
+			auto &row = naiveRows.emplace_back();
+			std::int32_t x = 0;
+			for (std::string_view text = kText; !text.empty(); )
+			{
+				const Unicode::CodePoint kCodePoint = Unicode::Decode(text);
+				row.push_back(std::make_unique<NaiveCharacter>(kCodePoint.value, kStyle, Point{ x, y }, 8, 16));
+				x += 8;
+				text.remove_prefix(kCodePoint.length);
+			}
+
+			y += 16;
+		}
+	});
+	const std::size_t kNaiveHeap = GetHeapUsage() - heapStart;
+	Report("Build rows, heap object per character", numCharacters, seconds, "char");
+
+	const CharacterPool::Stats kStats = pool.GetStats();
+	std::size_t rowBytes = rows.capacity() * sizeof(Row);
+	for (const Row &kRow : rows)
+	{
+		rowBytes += kRow.GetMemoryUsage() - sizeof(Row);
+	}
+
+	std::cout << std::format("  Pool: {} distinct characters for {} requests, {} bytes\n", kStats.numCharacters,
+							 kStats.numRequests, kStats.numBytes);
+	std::cout << std::format("  Flyweight: {:.2f} bytes per character ({:.2f} measured on the heap)\n",
+							 static_cast<double>(rowBytes + kStats.numBytes) / static_cast<double>(numCharacters),
+							 static_cast<double>(kFlyweightHeap) / static_cast<double>(numCharacters));
+	std::cout << std::format("  Heap objects: {:.2f} bytes per character measured on the heap\n",
+							 static_cast<double>(kNaiveHeap) / static_cast<double>(numCharacters));
+
+	// Walking the rows, with positions computed from the row for the flyweights.
+	CountingVisitor flyweightVisitor;
+	std::int64_t checksum = 0;
+	seconds = Measure([&]()
+	{
+		std::int32_t y = 0;
+		for (const Row &kRow : rows)
+		{
+			kRow.ForEachChild(Point{ 0, y }, [&checksum](const IGlyph &, Point position) { checksum += position.x; });
+			kRow.VAccept(flyweightVisitor);
+			y += kRow.VGetHeight();
+		}
+	});
+	Report("Visit & position, flyweight", numCharacters, seconds, "char");
+
+	CountingVisitor naiveVisitor;
+	std::int64_t naiveChecksum = 0;
+	seconds = Measure([&]()
+	{
+		for (const auto &kRow : naiveRows)
+		{
+			for (const auto &kpCharacter : kRow)
+			{
+				naiveChecksum += kpCharacter->position.x;
+				kpCharacter->VAccept(naiveVisitor);
+			}
+
+			naiveVisitor.VVisitRow();
+		}
+	});
+	Report("Visit & position, heap objects", numCharacters, seconds, "char");
+	std::cout << std::format("  Positions {}, visited bytes {}\n", checksum == naiveChecksum ? "match" : "differ",
+							 flyweightVisitor.numBytes == naiveVisitor.numBytes ? "match" : "differ");
+}
+
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * @file   IncrementalBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Incremental spell checking benchmarks.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+void Lexi::Bench::RunIncrementalBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_PAGES = 500;
+	constexpr std::size_t kROWS_PER_PAGE = 50;
+	constexpr std::size_t kNUM_KEYSTROKES = 2000;
+	constexpr std::size_t kFULL_RECHECKS = 5;
+
+	const HashDictionary kDictionary(kOptions.wordDictPath);
+	WordList rows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_PAGES * kROWS_PER_PAGE);
+	std::size_t numBytes = 0;
+	for (const auto &kRow : rows)
+	{
+		numBytes += kRow.size();
+	}
+	std::cout << std::format("  {} rows, {} bytes\n", rows.size(), numBytes);
+
+	IncrementalSpellChecker checker(kDictionary);
+	double seconds = Measure([&]()
+	{
+		for (std::size_t index = 0; index < rows.size(); ++index)
+		{
+			checker.SetRow(index, rows[index]);
+		}
+	});
+	Report("Initial check", rows.size(), seconds, "row");
+	// Typing: every keystroke inserts a character into one row, which is then re-reported.
+	seconds = Measure([&]()
+	{
+		for (std::size_t keystroke = 0; keystroke < kNUM_KEYSTROKES; ++keystroke)
+		{
+			const std::size_t kRowIndex = (keystroke / 8 * 7919) % rows.size();
+			auto &row = rows[kRowIndex];
+			row.insert(keystroke % row.size(), 1, static_cast<char>('a' + keystroke % 26));
+			checker.SetRow(kRowIndex, row);
+		}
+	});
+	Report("Incremental keystroke", kNUM_KEYSTROKES, seconds, "edit");
+	// Without a cache every keystroke re-checks the whole document.
+	std::size_t numMisspellings = 0;
+	seconds = Measure([&]()
+	{
+		for (std::size_t recheck = 0; recheck < kFULL_RECHECKS; ++recheck)
+		{
+			for (const auto &kRow : rows)
+			{
+				numMisspellings += IncrementalSpellChecker::CheckText(kDictionary, kRow).size();
+			}
+		}
+	});
+	DoNotOptimize(numMisspellings);
+	Report("Full re-check per keystroke", kFULL_RECHECKS, seconds, "edit");
+
+	const auto &kStats = checker.GetStats();
+	std::cout << std::format("  {} row updates, {} rows checked, {} cache hits, {} words looked up\n",
+							 kStats.numRowUpdates, kStats.numRowsChecked, kStats.numCacheHits, kStats.numWordsChecked);
+
+	// Adding a word must not leave cached rows stale.
+	MutableDictionary userDictionary;
+	IncrementalSpellChecker userChecker(userDictionary);
+	userChecker.SetRow(0, "hello wurld");
+	userChecker.SetRow(1, "wurld");
+	userDictionary.Insert("wurld");
+	userChecker.SetRow(0, "hello wurld");
+	std::cout << std::format("  After adding a word: {} & {} misspelling(s) (expected 1 & 0), {} refresh(es)\n",
+							 userChecker.GetRowMisspellings(0).size(), userChecker.GetRowMisspellings(1).size(),
+							 userChecker.GetStats().numRefreshes);
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * @file   ParallelLayoutBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Parallel paragraph layout, scaling over thread counts.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Row lengths of every paragraph, to compare layouts.
+	std::vector<std::size_t> GetRowLengths(const Lexi::Composition &kComposition)
+	{
+		std::vector<std::size_t> rowLengths;
+		for (std::size_t paragraph = 0; paragraph < kComposition.GetNumParagraphs(); ++paragraph)
+		{
+			for (const Lexi::Row &kRow : kComposition.GetRows(paragraph))
+			{
+				rowLengths.push_back(kRow.GetNumChildren());
+			}
+		}
+		return rowLengths;
+	}
+}
+
+void Lexi::Bench::RunParallelLayoutBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_PARAGRAPHS = 20'000;
+	constexpr std::size_t kROWS_PER_PARAGRAPH = 8;
+	constexpr std::int32_t kLINE_WIDTH = 480;
+	constexpr std::int32_t kRESIZED_LINE_WIDTH = 640;
+	constexpr std::int32_t kPAGE_HEIGHT = 1'000;
+	constexpr std::int32_t kLINE_HEIGHT = 16;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_PARAGRAPHS * kROWS_PER_PARAGRAPH);
+	std::string text;
+	for (std::size_t index = 0; index < kRows.size(); ++index)
+	{
+		text += kRows[index];
+		text += ((index + 1) % kROWS_PER_PARAGRAPH == 0) ? '\n' : ' ';
+	}
+
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, kLINE_HEIGHT });
+	std::cout << std::format("  {} paragraphs, {} hardware thread(s)\n", kNUM_PARAGRAPHS,
+							 std::thread::hardware_concurrency());
+
+	std::vector<std::size_t> threadCounts{1, 2, 4};
+	if (std::thread::hardware_concurrency() > 4)
+	{
+		threadCounts.push_back(std::thread::hardware_concurrency());
+	}
+
+	for (const bool kbTeX : { false, true })
+	{
+		const auto kMakeCompositor = [kbTeX]() -> UniqueICompositorPtr
+		{
+			return kbTeX ? UniqueICompositorPtr(std::make_unique<TeXCompositor>()) : std::make_unique<SimpleCompositor>();
+		};
+
+		// Sequential baseline, what the parallel layouts are compared against.
+		Composition expected(kMakeCompositor(), kLINE_WIDTH, kPAGE_HEIGHT, kLINE_HEIGHT);
+		expected.Assign(text, pool, kStyle);
+		double openSeconds = Measure([&]() { expected.Compose(); });
+		const std::vector<std::size_t> kExpectedOpen = GetRowLengths(expected);
+		expected.SetLineWidth(kRESIZED_LINE_WIDTH);
+		double resizeSeconds = Measure([&]() { expected.Compose(); });
+		const std::vector<std::size_t> kExpectedResize = GetRowLengths(expected);
+		const std::string_view kName = expected.GetCompositor().VGetName();
+		Report(std::format("{}: open, sequential", kName), kNUM_PARAGRAPHS, openSeconds, "paragraph");
+		Report(std::format("{}: resize, sequential", kName), kNUM_PARAGRAPHS, resizeSeconds, "paragraph");
+		const double kBaseSeconds = openSeconds + resizeSeconds;
+		// An empty paragraph on top moves all the others: the sequential placement every pass ends with.
+		expected.InsertParagraph(0);
+		const double kPlaceSeconds = Measure([&]() { expected.Compose(); });
+		expected.EraseParagraph(0);
+		expected.Compose();
+		std::cout << std::format("  Placement alone takes {:.3f} ms, {:.1f}% of a sequential resize\n",
+								 kPlaceSeconds * 1000.0, kPlaceSeconds / resizeSeconds * 100.0);
+
+		for (const std::size_t kNumThreads : threadCounts)
+		{
+			ThreadPool threadPool(kNumThreads);
+			Composition composition(kMakeCompositor(), kLINE_WIDTH, kPAGE_HEIGHT, kLINE_HEIGHT);
+			composition.Assign(text, pool, kStyle);
+			openSeconds = Measure([&]() { composition.Compose(threadPool); });
+			const bool kbOpenMatches = GetRowLengths(composition) == kExpectedOpen;
+			composition.SetLineWidth(kRESIZED_LINE_WIDTH);
+			resizeSeconds = Measure([&]() { composition.Compose(threadPool); });
+			const bool kbMatches = kbOpenMatches && GetRowLengths(composition) == kExpectedResize &&
+								   composition.GetHeight() == expected.GetHeight();
+
+			Report(std::format("{}: open, {} thread(s)", kName, kNumThreads), kNUM_PARAGRAPHS, openSeconds, "paragraph");
+			Report(std::format("{}: resize, {} thread(s)", kName, kNumThreads), kNUM_PARAGRAPHS, resizeSeconds,
+				   "paragraph");
+			std::cout << std::format("  {:.2f}x the sequential layout, {} parallel pass(es), layouts {}\n",
+									 kBaseSeconds / (openSeconds + resizeSeconds),
+									 composition.GetStats().numParallelPasses, kbMatches ? "match" : "differ");
+		}
+
+		// Erasing the dirty last paragraph right before a parallel pass.
+		ThreadPool threadPool(2);
+		Composition composition(kMakeCompositor(), kLINE_WIDTH, kPAGE_HEIGHT, kLINE_HEIGHT);
+		composition.Assign(text, pool, kStyle);
+		composition.EraseParagraph(composition.GetNumParagraphs() - 1);
+		composition.Compose(threadPool);
+		expected.SetLineWidth(kLINE_WIDTH);
+		expected.EraseParagraph(expected.GetNumParagraphs() - 1);
+		expected.Compose();
+		std::cout << std::format("  Erasing the dirty last paragraph: {} parallel pass(es), layouts {}\n",
+								 composition.GetStats().numParallelPasses,
+								 GetRowLengths(composition) == GetRowLengths(expected) &&
+								 composition.GetHeight() == expected.GetHeight() ? "match" : "differ");
+
+		// With every worker busy (as during a background spell check), the calling thread lays out alone.
+		constexpr std::chrono::milliseconds kBUSY_TIME(1'000);
+		threadPool.Submit([kBUSY_TIME]() { std::this_thread::sleep_for(kBUSY_TIME); });
+		threadPool.Submit([kBUSY_TIME]() { std::this_thread::sleep_for(kBUSY_TIME); });
+		composition.SetLineWidth(kRESIZED_LINE_WIDTH);
+		const double kBusySeconds = Measure([&]() { composition.Compose(threadPool); });
+		Report(std::format("{}: resize, busy pool", kName), composition.GetNumParagraphs(), kBusySeconds, "paragraph");
+		std::cout << std::format("  {} for the pool's {} ms of other work\n",
+								 kBusySeconds < std::chrono::duration<double>(kBUSY_TIME).count() ? "Didn't wait" : "Waited",
+								 kBUSY_TIME.count());
+	}
+}
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * @file   PieceTableBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Piece table edit, undo & traversal benchmarks.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+namespace
+{
+	//! Counts the bytes it is shown.
+	class CountingVisitor final : public Lexi::IVisitor
+	{
+	public:
+		std::size_t numBytes = 0;
+
+		void VVisitCharacter(char) override { ++numBytes; }
+		void VVisitText(std::span<const char> text) override { numBytes += text.size(); }
+		void VVisitRow(void) override {}
+		void VVisitImage(void) override {}
+	};
+
+	//! One random edit, applied alike to the piece table & the reference string.
+	struct Edit
+	{
+		bool bErase;
+		std::size_t offset;
+		std::size_t length;
+	};
+
+	std::vector<Edit> MakeEdits(std::size_t numEdits, std::size_t size, unsigned seed)
+	{
+		std::mt19937 random(seed);
+		std::vector<Edit> edits;
+		edits.reserve(numEdits);
+		for (std::size_t index = 0; index < numEdits; ++index)
+		{
+			const bool kbErase = size > 64 && random() % 3 == 0;
+			const std::size_t kLength = 1 + random() % 16;
+			if (kbErase)
+			{
+				const std::size_t kOffset = random() % (size - kLength);
+				edits.push_back(Edit{ true, kOffset, kLength });
+				size -= kLength;
+			}
+			else
+			{
+				edits.push_back(Edit{ false, random() % (size + 1), kLength });
+				size += kLength;
+			}
+		}
+
+		return edits;
+	}
+}
+
+void Lexi::Bench::RunPieceTableBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 150'000;
+	constexpr std::size_t kNUM_EDITS = 200'000;
+	constexpr std::size_t kNUM_STRING_EDITS = 2'000;
+	constexpr std::string_view kINSERT_TEXT = "lorem ipsum text";
+
+	std::string document;
+	for (const auto &kRow : MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS))
+	{
+		document.append(kRow).push_back('\n');
+	}
+
+	const auto kPath = std::filesystem::temp_directory_path() / "LexiPieceTableBench.txt";
+	{
+		std::ofstream outFile(kPath, std::ios::binary);
+		outFile.write(document.data(), static_cast<std::streamsize>(document.size()));
+	}
+	std::cout << std::format("  Document: {} bytes\n", document.size());
+
+	// Opening maps the file instead of copying it.
+	std::optional<PieceTable> table;
+	double seconds = Measure([&]() { table.emplace(kPath); });
+	Report("Open, mapped piece table", 1, seconds, "file");
+	std::string readText;
+	seconds = Measure([&]()
+	{
+		std::ifstream inFile(kPath, std::ios::binary);
+		readText.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+	});
+	Report("Open, read into a string", 1, seconds, "file");
+	DoNotOptimize(readText.size());
+
+	// Random inserts & erases across the whole document.
+	const std::vector<Edit> kEdits = MakeEdits(kNUM_EDITS, document.size(), 7);
+	seconds = Measure([&]()
+	{
+		for (const Edit &kEdit : kEdits)
+		{
+			if (kEdit.bErase)
+			{
+				table->Erase(kEdit.offset, kEdit.length);
+			}
+			else
+			{
+				table->Insert(kEdit.offset, kINSERT_TEXT.substr(0, kEdit.length));
+			}
+		}
+	});
+	Report("Random edits, piece table", kEdits.size(), seconds, "edit");
+	std::cout << std::format("  {} pieces, {} bytes besides the mapped file\n", table->GetNumPieces(),
+							 table->GetMemoryUsage());
+
+	std::string reference = document;
+	seconds = Measure([&]()
+	{
+		for (const Edit &kEdit : std::span(kEdits).first(kNUM_STRING_EDITS))
+		{
+			if (kEdit.bErase)
+			{
+				reference.erase(kEdit.offset, kEdit.length);
+			}
+			else
+			{
+				reference.insert(kEdit.offset, kINSERT_TEXT.substr(0, kEdit.length));
+			}
+		}
+	});
+	Report("Random edits, std::string", kNUM_STRING_EDITS, seconds, "edit");
+
+	// Traversal of the fragmented document.
+	std::size_t checksum = 0;
+	seconds = Measure([&]()
+	{
+		for (const char kChar : *table)
+		{
+			checksum += static_cast<unsigned char>(kChar);
+		}
+	});
+	ReportBytes("Iterate characters", table->GetSize(), seconds);
+	DoNotOptimize(checksum);
+
+	CountingVisitor visitor;
+	seconds = Measure([&]() { table->Accept(visitor); });
+	ReportBytes("Visit pieces", table->GetSize(), seconds);
+
+	// Undo everything back to the file, then redo it all.
+	std::size_t numUndos = 0;
+	seconds = Measure([&]()
+	{
+		while (table->Undo())
+		{
+			++numUndos;
+		}
+	});
+	Report("Undo", numUndos, seconds, "edit");
+	const bool kbUndoMatches = table->GetText() == document;
+	seconds = Measure([&]()
+	{
+		while (table->Redo())
+		{
+		}
+	});
+	Report("Redo", numUndos, seconds, "edit");
+
+	// Typing at one spot grows a single piece.
+	PieceTable typed = PieceTable::FromText(document);
+	const std::size_t kTypeOffset = document.size() / 2;
+	seconds = Measure([&]()
+	{
+		for (std::size_t index = 0; index < kNUM_EDITS; ++index)
+		{
+			typed.Insert(kTypeOffset + index, kINSERT_TEXT.substr(index % kINSERT_TEXT.size(), 1));
+		}
+	});
+	Report("Typing, piece table", kNUM_EDITS, seconds, "char");
+	std::cout << std::format("  {} pieces after typing\n", typed.GetNumPieces());
+
+	// Check the table against a string given the same edits, undos & redos.
+	PieceTable checked = PieceTable::FromText(document.substr(0, 4096));
+	std::string expected = document.substr(0, 4096);
+	std::vector<std::string> history;
+	std::mt19937 random(11);
+	std::size_t numMismatches = 0;
+	for (const Edit &kEdit : MakeEdits(5'000, expected.size(), 13))
+	{
+		if (random() % 8 == 0 && !history.empty())
+		{
+			checked.Undo();
+			expected = history.back();
+			history.pop_back();
+		}
+		else
+		{
+			// Edits are regenerated against the current size, since undos change it.
+			const std::size_t kOffset = kEdit.offset % (expected.size() + 1);
+			const std::size_t kLength = std::min(kEdit.length, expected.size() - kOffset);
+			if (kEdit.bErase && kLength == 0)
+			{
+				continue;
+			}
+
+			history.push_back(expected);
+			if (kEdit.bErase)
+			{
+				checked.Erase(kOffset, kLength);
+				expected.erase(kOffset, kLength);
+			}
+			else
+			{
+				checked.Insert(kOffset, kINSERT_TEXT.substr(0, kEdit.length));
+				expected.insert(kOffset, kINSERT_TEXT.substr(0, kEdit.length));
+			}
+		}
+
+		const std::size_t kProbe = expected.empty() ? 0 : random() % expected.size();
+		if (checked.GetSize() != expected.size() || !std::ranges::equal(checked, expected) ||
+			(!expected.empty() && checked.GetChar(kProbe) != expected[kProbe]) ||
+			checked.GetText(kProbe, std::min<std::size_t>(32, expected.size() - kProbe)) !=
+				expected.substr(kProbe, 32))
+		{
+			++numMismatches;
+		}
+	}
+
+	std::cout << std::format("  Undo to the file {}, {} mismatches against the string over 5000 edits\n",
+							 kbUndoMatches ? "matches" : "differs", numMismatches);
+	table.reset();
+	std::filesystem::remove(kPath);
+}
+
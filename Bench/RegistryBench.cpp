@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * @file   RegistryBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Per-visitor dictionary loading vs the shared registry.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+void Lexi::Bench::RunRegistryBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_DOCUMENTS = 8;
+	constexpr std::size_t kNUM_USER_WORDS = 100;
+
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	// Every open document loading its own dictionary (the old behaviour).
+	std::vector<UniqueSpellCheckVisitorPtr> visitors;
+	std::size_t numBytes = 0;
+	double seconds = Measure([&]()
+	{
+		for (std::size_t i = 0; i < kNUM_DOCUMENTS; ++i)
+		{
+			visitors.push_back(std::make_unique<SpellCheckVisitor>(
+				LoadDictionary(kOptions.wordDictPath, Config::DictionaryStorage::kHash)));
+			numBytes += visitors.back()->GetDictionary().GetBase().VGetMemoryUsage();
+		}
+	});
+	Report("Open documents, loading per visitor", kNUM_DOCUMENTS, seconds, "docs");
+	std::cout << std::format("  {} bytes of dictionaries\n", numBytes);
+	visitors.clear();
+	// Sharing one instance through the registry.
+	DictionaryRegistry &registry = DictionaryRegistry::Get();
+	const auto kStatsBefore = registry.GetStats();
+	numBytes = 0;
+	seconds = Measure([&]()
+	{
+		for (std::size_t i = 0; i < kNUM_DOCUMENTS; ++i)
+		{
+			visitors.push_back(std::make_unique<SpellCheckVisitor>(
+				registry.Acquire(kOptions.wordDictPath, Config::DictionaryStorage::kHash)));
+			numBytes += visitors.back()->GetDictionary().VGetMemoryUsage();
+		}
+	});
+	Report("Open documents, shared registry", kNUM_DOCUMENTS, seconds, "docs");
+	const auto kStats = registry.GetStats();
+	std::cout << std::format("  {} bytes of dictionaries + {} bytes of layers, {} load(s) for {} acquisitions\n",
+							 visitors.front()->GetDictionary().GetBase().VGetMemoryUsage(), numBytes,
+							 kStats.numLoads - kStatsBefore.numLoads, kStats.numAcquires - kStatsBefore.numAcquires);
+	visitors.clear();
+	std::cout << std::format("  {} dictionaries loaded after closing every document\n", registry.GetNumLoaded());
+	// Lookup cost of the layers: hits stop at the base, misses also probe the user dictionary & ignore list.
+	const DictionaryHandle kpBase = registry.Acquire(kOptions.wordDictPath, Config::DictionaryStorage::kHash);
+	const WordList kMisses = MakeMisses(kWords);
+	auto pUserDictionary = std::make_shared<MutableDictionary>();
+	LayeredDictionary layered(kpBase, pUserDictionary);
+	for (std::size_t i = 0; i < kNUM_USER_WORDS && i < kMisses.size(); ++i)
+	{
+		layered.AddToUserDictionary(kMisses[i]);
+		layered.Ignore(kMisses[kMisses.size() - 1 - i]);
+	}
+
+	for (const auto &[kName, kpDictionary] : { std::pair<std::string_view, const IDictionary *>{ "base", kpBase.get() },
+											  { "layered", &layered } })
+	{
+		for (const auto &[kKind, kpList] : { std::pair<std::string_view, const WordList *>{ "hits", &kWords },
+											{ "misses", &kMisses } })
+		{
+			std::size_t numFound = 0;
+			seconds = Measure([&]()
+			{
+				for (const auto &kWord : *kpList)
+				{
+					numFound += kpDictionary->VContains(kWord);
+				}
+			});
+			DoNotOptimize(numFound);
+			Report(std::format("Lookup {}, {}", kKind, kName), kpList->size(), seconds, "lookups");
+		}
+	}
+}
+
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * @file   ReloadBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Lookups while dictionaries are swapped & reloaded.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+void Lexi::Bench::RunReloadBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_PUBLISHES = 20;
+	constexpr std::size_t kBATCH_SIZE = 1024;
+	constexpr std::string_view kNEW_WORD = "zyzzyvaqux";
+
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	// Read-side cost of the read-copy-update section.
+	const HashDictionary kPlain(kOptions.wordDictPath);
+	ReloadableDictionary reloadable(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+	for (const auto &[kName, kpDictionary] : { std::pair<std::string_view, const IDictionary *>{ "plain", &kPlain },
+											  { "reloadable", &reloadable } })
+	{
+		std::size_t numFound = 0;
+		const double kSeconds = Measure([&]()
+		{
+			for (const auto &kWord : kWords)
+			{
+				numFound += kpDictionary->VContains(kWord);
+			}
+		});
+		DoNotOptimize(numFound);
+		Report(std::format("Lookup, {}", kName), kWords.size(), kSeconds, "lookups");
+	}
+	// Lookups while another thread keeps publishing new versions.
+	std::atomic<bool> bPublishing{ true };
+	std::thread publisher([&]()
+	{
+		for (std::size_t i = 0; i < kNUM_PUBLISHES; ++i)
+		{
+			reloadable.Publish(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+		}
+
+		bPublishing = false;
+	});
+
+	std::size_t numLookups = 0;
+	std::size_t numMissing = 0;
+	double maxBatchSeconds = 0.0;
+	const double kSeconds = Measure([&]()
+	{
+		std::size_t wordIndex = 0;
+		while (bPublishing)
+		{
+			const auto kStart = Clock::now();
+			for (std::size_t i = 0; i < kBATCH_SIZE; ++i, wordIndex = (wordIndex + 1) % kWords.size())
+			{
+				numMissing += !reloadable.VContains(kWords[wordIndex]);
+			}
+
+			maxBatchSeconds = std::max(maxBatchSeconds, std::chrono::duration<double>(Clock::now() - kStart).count());
+			numLookups += kBATCH_SIZE;
+		}
+	});
+	publisher.join();
+	Report("Lookup during reloads", numLookups, kSeconds, "lookups");
+	std::cout << std::format("  {} versions published, {} words missing, slowest batch of {} {:.3f} ms\n",
+							 reloadable.GetVersion(), numMissing, kBATCH_SIZE, maxBatchSeconds * 1000.0);
+	// Suggestions & cached rows follow a published version.
+	const auto kpReloadable = std::make_shared<ReloadableDictionary>(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+	SpellCheckVisitor visitor(kpReloadable);
+	const auto kSuggests = [&visitor, kNEW_WORD]()
+	{
+		return std::ranges::any_of(visitor.Suggest("zyzzyvaqix").candidates, [kNEW_WORD](const auto &kSuggestion)
+		{
+			return kSuggestion.word == kNEW_WORD;
+		});
+	};
+	const bool kbSuggestedBefore = kSuggests();
+	visitor.GetRowChecker().SetRow(0, kNEW_WORD);
+	auto pNewVersion = std::make_unique<HashDictionary>(kOptions.wordDictPath);
+	pNewVersion->Insert(kNEW_WORD);
+	kpReloadable->Publish(std::move(pNewVersion));
+	std::cout << std::format("  After publishing a new word: suggested {} -> {}, row misspellings {}\n",
+							 kbSuggestedBefore, kSuggests(), visitor.GetRowChecker().GetRowMisspellings(0).size());
+	// A reloaded user dictionary drops the words deleted from its file.
+	const auto kDirectory = std::filesystem::temp_directory_path() / "LexiReloadBench";
+	std::filesystem::create_directories(kDirectory);
+	const auto kUserPath = kDirectory / "User.txt";
+	MutableDictionary userDictionary;
+	userDictionary.Insert("lexi");
+	userDictionary.Insert(kNEW_WORD);
+	userDictionary.Save(kUserPath);
+	{
+		std::ofstream outFile(kUserPath, std::ios::trunc);
+		outFile << "lexi\n";
+	}
+
+	userDictionary.Reload(kUserPath);
+	std::cout << std::format("  User dictionary reloaded: {} word(s), deleted word {}\n", userDictionary.VGetSize(),
+							 userDictionary.VContains(kNEW_WORD) ? "still accepted" : "dropped");
+	// End to end: replace the file & wait for the registry to publish it.
+	DictionaryRegistry &registry = DictionaryRegistry::Get();
+	if (!FileWatcher::IsSupported())
+	{
+		std::cout << "  File watching is unsupported, skipping hot reload.\n";
+		std::filesystem::remove_all(kDirectory);
+		return;
+	}
+
+	const auto kPath = kDirectory / "Words.txt";
+	std::filesystem::copy_file(kOptions.wordDictPath, kPath, std::filesystem::copy_options::overwrite_existing);
+
+	const DictionaryHandle kpDictionary = registry.Acquire(kPath, Config::DictionaryStorage::kHash);
+	registry.EnableHotReload();
+	const auto kTempPath = kDirectory / "Words.txt.new";
+	std::filesystem::copy_file(kPath, kTempPath, std::filesystem::copy_options::overwrite_existing);
+	{
+		std::ofstream outFile(kTempPath, std::ios::app);
+		outFile << kNEW_WORD << '\n';
+	}
+
+	const auto kStart = Clock::now();
+	std::filesystem::rename(kTempPath, kPath);
+	while (!kpDictionary->VContains(kNEW_WORD) && Clock::now() - kStart < std::chrono::seconds(5))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	const bool kbReloaded = kpDictionary->VContains(kNEW_WORD);
+	std::cout << std::format("  File replaced, new word {} after {:.1f} ms (including the {} ms settle time)\n",
+							 kbReloaded ? "visible" : "NOT visible",
+							 std::chrono::duration<double, std::milli>(Clock::now() - kStart).count(),
+							 FileWatcher::kSETTLE_TIME.count());
+	// Editing the rules of a Hunspell dictionary reloads it, even while other files keep changing.
+	const auto kAffixPath = kDirectory / "Words.aff";
+	const auto kStemPath = kDirectory / "Words.dic";
+	{
+		std::ofstream(kAffixPath) << "SET UTF-8\n";
+		std::ofstream(kStemPath) << "1\nlexi/S\n";
+	}
+
+	const DictionaryHandle kpAffixDictionary = registry.Acquire(kStemPath, Config::DictionaryStorage::kHash);
+	std::atomic<bool> bStopNoise = false;
+	std::thread noiseThread([&bStopNoise, kNoisePath = kDirectory / "Noise.txt"]()
+	{
+		while (!bStopNoise)
+		{
+			std::ofstream(kNoisePath, std::ios::app) << '.';
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		}
+	});
+
+	const auto kAffixStart = Clock::now();
+	{
+		std::ofstream(kAffixPath, std::ios::app) << "SFX S Y 1\nSFX S 0 s .\n";
+	}
+
+	while (!kpAffixDictionary->VContains("lexis") && Clock::now() - kAffixStart < std::chrono::seconds(5))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	const bool kbAffixReloaded = kpAffixDictionary->VContains("lexis");
+	bStopNoise = true;
+	noiseThread.join();
+	std::cout << std::format("  Affix file edited next to a busy file, new suffix {} after {:.1f} ms\n",
+							 kbAffixReloaded ? "accepted" : "NOT accepted",
+							 std::chrono::duration<double, std::milli>(Clock::now() - kAffixStart).count());
+	registry.DisableHotReload();
+	std::filesystem::remove_all(kDirectory);
+}
+
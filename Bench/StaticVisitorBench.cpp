@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * @file   StaticVisitorBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Static against virtual visitor dispatch.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+namespace
+{
+	//! Counts bytes, letters & rows; cheap enough that dispatch dominates.
+	class CountingVisitor final : public Lexi::StaticVisitor<CountingVisitor>
+	{
+	public:
+		std::size_t numBytes = 0;
+		std::size_t numLetters = 0;
+		std::size_t numRows = 0;
+
+		void VisitCharacter(char ch)
+		{
+			++numBytes;
+			numLetters += Lexi::WordTokenizer::IsWordChar(ch);
+		}
+
+		void VisitRow(void) { ++numRows; }
+
+		bool operator==(const CountingVisitor &kOther) const noexcept
+		{
+			return numBytes == kOther.numBytes && numLetters == kOther.numLetters && numRows == kOther.numRows;
+		}
+	};
+}
+
+void Lexi::Bench::RunStaticVisitorBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 100'000;
+
+	const WordList kRows = MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS);
+	CharacterPool pool;
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "Monospace", 8, 16 });
+	std::vector<Row> rows;
+	rows.reserve(kRows.size());
+	std::size_t numBytes = 0;
+	for (const auto &kText : kRows)
+	{
+		Row &row = rows.emplace_back();
+		row.Reserve(kText.size());
+		for (std::string_view text = kText; !text.empty(); )
+		{
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(text);
+			row.Append(pool.Get(kCodePoint.value, kStyle));
+			text.remove_prefix(kCodePoint.length);
+		}
+
+		numBytes += kText.size();
+	}
+	// Counting: the visitor itself costs next to nothing.
+	CountingVisitor virtualCounter;
+	double seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.VAccept(virtualCounter);
+		}
+	});
+	ReportBytes("Count, virtual dispatch", numBytes, seconds);
+
+	CountingVisitor staticCounter;
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.Accept(staticCounter);
+		}
+	});
+	ReportBytes("Count, static dispatch", numBytes, seconds);
+
+	// Spell checking character by character.
+	auto pDictionary = std::make_shared<HashDictionary>(kOptions.wordDictPath);
+	SpellCheckVisitor virtualChecker(pDictionary);
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.VAccept(virtualChecker);
+		}
+	});
+	ReportBytes("Spell check, virtual dispatch", numBytes, seconds);
+
+	SpellCheckVisitor staticChecker(pDictionary);
+	seconds = Measure([&]()
+	{
+		for (const Row &kRow : rows)
+		{
+			kRow.Accept(staticChecker);
+		}
+	});
+	ReportBytes("Spell check, static dispatch", numBytes, seconds);
+
+	std::cout << std::format("  Counts {}, {} misspellings {}\n", virtualCounter == staticCounter ? "match" : "differ",
+							 staticChecker.GetMisspellings().size(),
+							 virtualChecker.GetMisspellings() == staticChecker.GetMisspellings() ? "match" : "differ");
+}
+
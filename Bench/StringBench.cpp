@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * @file   StringBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  String helper benchmark & kernel cross-check.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+//! Pre-SIMD implementation (locale aware, allocating) kept as the baseline.
+static std::string LocaleStringToLower(std::string_view input)
+{
+	std::string output;
+	output.reserve(input.size());
+	std::ranges::transform(input, std::back_inserter(output),
+						   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+	return output;
+}
+
+//! Compare every kernel level against the C library on random input, returns the number of mismatches.
+static std::size_t CrossCheckKernels(void)
+{
+	using namespace Lexi;
+
+	constexpr std::size_t kNUM_CASES = 20'000;
+	constexpr std::size_t kMAX_LENGTH = 100; // Covers the 32 & 16 byte blocks & every tail length
+	// Letters plus the bytes on either side of 'A'-'Z' & 'a'-'z', and some non-ASCII ones.
+	constexpr std::string_view kEDGE_BYTES = "@[`{AZaz\x80\xC1\xDA\xE1\xFA\xFF";
+
+	std::mt19937 rng(7);
+	std::size_t numMismatches = 0;
+	std::string input, output;
+	for (std::size_t testCase = 0; testCase < kNUM_CASES; ++testCase)
+	{
+		input.resize(rng() % kMAX_LENGTH);
+		const bool kbLettersOnly = testCase % 2 == 0; // Otherwise IsStringAlpha is almost always false
+		for (char &ch : input)
+		{
+			const unsigned kPick = rng() % 8;
+			if (kbLettersOnly || kPick < 5)
+			{
+				ch = static_cast<char>(((rng() % 2) ? 'a' : 'A') + rng() % 26);
+			}
+			else
+			{
+				ch = (kPick == 5) ? kEDGE_BYTES[rng() % kEDGE_BYTES.size()] : static_cast<char>(rng() % 256);
+			}
+		}
+		// Lexi runs in the "C" locale, where the C library is the reference.
+		const bool kbExpectedAlpha = std::ranges::all_of(input, [](unsigned char ch) { return std::isalpha(ch) != 0; });
+		const std::string kExpectedLower = LocaleStringToLower(input);
+		for (auto level = SimdLevel::kScalar; level <= GetSupportedSimdLevel();
+			 level = static_cast<SimdLevel>(static_cast<int>(level) + 1))
+		{
+			SetSimdLevel(level);
+			output.assign(input.size(), '\0');
+			bool bMatch = IsStringAlpha(input) == kbExpectedAlpha;
+			bMatch = bMatch && StringToLower(input) == kExpectedLower;
+			bMatch = bMatch && StringToLower(input, output.data()) == kExpectedLower;
+			output = input;
+			StringToLowerInPlace(output);
+			bMatch = bMatch && output == kExpectedLower;
+			numMismatches += !bMatch;
+		}
+	}
+
+	SetSimdLevel(GetSupportedSimdLevel());
+	return numMismatches;
+}
+
+void Lexi::Bench::RunStringBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_REPEATS = 20;
+
+	std::cout << std::format("  Supported: {}, kernel cross-check: {} mismatch(es)\n",
+							 SimdLevelToString(GetSupportedSimdLevel()), CrossCheckKernels());
+
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	// Rows with everything but letters removed, so IsStringAlpha has to scan all of them.
+	WordList letterRows = MakeRows(kWords, 10'000);
+	for (auto &row : letterRows)
+	{
+		std::erase_if(row, [](char ch) { return !WordTokenizer::IsWordChar(ch); });
+	}
+
+	const WordList &kLetterRows = letterRows;
+	for (const auto &[kName, kInputs] : { std::pair{ "words", &kWords }, std::pair{ "rows", &kLetterRows } })
+	{
+		std::size_t numBytes = 0;
+		for (const auto &kInput : *kInputs)
+		{
+			numBytes += kInput.size();
+		}
+
+		numBytes *= kNUM_REPEATS;
+		std::size_t checksum = 0;
+		double seconds = Measure([&]()
+		{
+			for (std::size_t repeat = 0; repeat < kNUM_REPEATS; ++repeat)
+			{
+				for (const auto &kInput : *kInputs)
+				{
+					checksum += LocaleStringToLower(kInput).size();
+				}
+			}
+		});
+		ReportBytes(std::format("{}: std::tolower, allocating", kName), numBytes, seconds);
+
+		std::string buffer;
+		for (auto level = SimdLevel::kScalar; level <= GetSupportedSimdLevel();
+			 level = static_cast<SimdLevel>(static_cast<int>(level) + 1))
+		{
+			SetSimdLevel(level);
+			seconds = Measure([&]()
+			{
+				for (std::size_t repeat = 0; repeat < kNUM_REPEATS; ++repeat)
+				{
+					for (const auto &kInput : *kInputs)
+					{
+						checksum += IsStringAlpha(kInput);
+					}
+				}
+			});
+			ReportBytes(std::format("{}: IsStringAlpha, {}", kName, SimdLevelToString(level)), numBytes, seconds);
+
+			seconds = Measure([&]()
+			{
+				for (std::size_t repeat = 0; repeat < kNUM_REPEATS; ++repeat)
+				{
+					for (const auto &kInput : *kInputs)
+					{
+						checksum += StringToLower(kInput).size();
+					}
+				}
+			});
+			ReportBytes(std::format("{}: StringToLower, {}", kName, SimdLevelToString(level)), numBytes, seconds);
+
+			seconds = Measure([&]()
+			{
+				for (std::size_t repeat = 0; repeat < kNUM_REPEATS; ++repeat)
+				{
+					for (const auto &kInput : *kInputs)
+					{
+						buffer.resize(kInput.size());
+						checksum += StringToLower(kInput, buffer.data()).front();
+					}
+				}
+			});
+			ReportBytes(std::format("{}: StringToLower buffer, {}", kName, SimdLevelToString(level)), numBytes, seconds);
+		}
+
+		SetSimdLevel(GetSupportedSimdLevel());
+		DoNotOptimize(checksum);
+	}
+}
+
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * @file   SuggestionBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Spelling suggestion benchmarks.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+//! Apply numEdits random edits (delete, insert, substitute or transpose).
+static std::string Misspell(std::string word, std::size_t numEdits, std::mt19937 &rng)
+{
+	std::uniform_int_distribution<int> letterDist('a', 'z');
+	for (std::size_t edit = 0; edit < numEdits && word.size() > 1; ++edit)
+	{
+		std::uniform_int_distribution<std::size_t> posDist(0, word.size() - 2);
+		const std::size_t kPos = posDist(rng);
+		switch (rng() % 4)
+		{
+		case 0:
+			word.erase(kPos, 1);
+			break;
+		case 1:
+			word.insert(kPos, 1, static_cast<char>(letterDist(rng)));
+			break;
+		case 2:
+			word[kPos] = static_cast<char>(letterDist(rng));
+			break;
+		default:
+			std::swap(word[kPos], word[kPos + 1]);
+			break;
+		}
+	}
+
+	return word;
+}
+
+void Lexi::Bench::RunSuggestionBench(const Options &kOptions)
+{
+	using Microseconds = std::chrono::duration<double, std::micro>;
+	constexpr std::size_t kSAMPLE_STRIDE = 23;
+	constexpr std::size_t kNAIVE_QUERIES = 200;
+
+	const HashDictionary kDictionary(kOptions.wordDictPath);
+	SuggestionEngine engine;
+	double seconds = Measure([&]() { engine = SuggestionEngine(kDictionary); });
+	Report("SuggestionEngine build", engine.GetSize(), seconds, "word");
+	std::cout << std::format("  index {} bytes ({:.1f} bytes/word)\n", engine.GetMemoryUsage(),
+							 static_cast<double>(engine.GetMemoryUsage()) / static_cast<double>(engine.GetSize()));
+
+	std::mt19937 rng(12345);
+	std::vector<std::pair<std::string, std::string>> queries; // (original, misspelled)
+	std::size_t sampleIndex = 0;
+	kDictionary.VForEachWord([&](std::string_view word)
+	{
+		if (sampleIndex++ % kSAMPLE_STRIDE == 0 && word.size() >= 4)
+		{
+			queries.emplace_back(word, Misspell(std::string(word), 1 + queries.size() % 2, rng));
+		}
+	});
+
+	for (const auto kBudget : { SuggestionEngine::kDEFAULT_BUDGET, SuggestionEngine::Microseconds(50) })
+	{
+		std::vector<double> latencies;
+		std::size_t numRecalled = 0;
+		std::size_t numTimedOut = 0;
+		latencies.reserve(queries.size());
+		for (const auto &[kOriginal, kQuery] : queries)
+		{
+			SuggestionEngine::Suggestions result;
+			latencies.push_back(Microseconds(std::chrono::duration<double>(Measure([&]()
+			{
+				result = engine.Suggest(kQuery, SuggestionEngine::kDEFAULT_MAX_RESULTS, kBudget);
+			}))).count());
+
+			numTimedOut += result.bTimedOut;
+			numRecalled += std::ranges::any_of(result.candidates, [&kOriginal](const auto &kSuggestion)
+			{
+				return kSuggestion.word == kOriginal;
+			});
+		}
+
+		std::ranges::sort(latencies);
+		const double kTotal = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+		std::cout << std::format("  budget {:>4} us: {} queries, mean {:.1f} us, p50 {:.1f} us, p99 {:.1f} us, "
+								 "max {:.1f} us, recall@{} {:.1f}%, {} timed out\n",
+								 kBudget.count(), latencies.size(), kTotal / static_cast<double>(latencies.size()),
+								 latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100], latencies.back(),
+								 SuggestionEngine::kDEFAULT_MAX_RESULTS,
+								 100.0 * static_cast<double>(numRecalled) / static_cast<double>(queries.size()),
+								 numTimedOut);
+	}
+	// Baseline: edit distance against every dictionary word.
+	std::size_t numMatches = 0;
+	seconds = Measure([&]()
+	{
+		for (std::size_t index = 0; index < kNAIVE_QUERIES && index < queries.size(); ++index)
+		{
+			kDictionary.VForEachWord([&](std::string_view word)
+			{
+				numMatches += SuggestionEngine::EditDistance(queries[index].second, word,
+															 SuggestionEngine::kMAX_DISTANCE) <= SuggestionEngine::kMAX_DISTANCE;
+			});
+		}
+	});
+	DoNotOptimize(numMatches);
+	Report("Naive edit distance scan", std::min(kNAIVE_QUERIES, queries.size()), seconds, "query");
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * @file   UnicodeBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  UTF-8 tokenizing on ASCII & mixed-script text.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+#include <random>
+
+//! Words outside ASCII: Latin with diacritics, Greek, Cyrillic, CJK & a few non-letters.
+static constexpr std::string_view kFOREIGN_WORDS[] = {
+	"café", "naïve", "façade", "Straße", "über", "Ångström", "smörgåsbord", "jalapeño", "Ærø", "Łódź",
+	"αλφάβητο", "Ελλάδα", "русский", "словарь", "日本語", "中文", "한국어", "€100", "—", "😀"
+};
+
+//! Runs of letters found by decoding every code point, the reference for WordTokenizer::ForEachRun().
+static Lexi::WordRangeVector TokenizeReference(std::string_view text)
+{
+	Lexi::WordRangeVector runs;
+	std::size_t runStart = 0;
+	bool bInRun = false;
+	std::size_t offset = 0;
+	while (offset < text.size())
+	{
+		const Lexi::Unicode::CodePoint kCodePoint = Lexi::Unicode::Decode(text.substr(offset));
+		const bool kbLetter = Lexi::WordTokenizer::IsWordCodePoint(kCodePoint.value);
+		if (kbLetter && !bInRun)
+		{
+			runStart = offset;
+		}
+		else if (!kbLetter && bInRun)
+		{
+			runs.push_back(Lexi::WordRange{ static_cast<std::uint32_t>(runStart),
+											static_cast<std::uint32_t>(offset - runStart) });
+		}
+
+		bInRun = kbLetter;
+		offset += kCodePoint.length;
+	}
+
+	if (bInRun)
+	{
+		runs.push_back(Lexi::WordRange{ static_cast<std::uint32_t>(runStart),
+										static_cast<std::uint32_t>(offset - runStart) });
+	}
+
+	return runs;
+}
+
+//! Random text of ASCII, foreign words & stray bytes (truncated sequences, lone continuation bytes).
+static std::string MakeNoise(std::mt19937 &rng, std::size_t size)
+{
+	constexpr std::string_view kASCII = "abcXYZ  ,.'-0";
+	std::string text;
+	while (text.size() < size)
+	{
+		switch (rng() % 4)
+		{
+		case 0:
+		case 1:
+			text += kASCII[rng() % kASCII.size()];
+			break;
+		case 2:
+			text += kFOREIGN_WORDS[rng() % std::size(kFOREIGN_WORDS)];
+			break;
+		default:
+			text += static_cast<char>(0x80 + rng() % 0x80);
+			break;
+		}
+	}
+
+	return text;
+}
+
+void Lexi::Bench::RunUnicodeBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 50'000;
+	constexpr std::size_t kNUM_NOISE_CASES = 2000;
+
+	// Same rows twice: pure ASCII, & with about one word in four drawn from other scripts.
+	const WordList kWords = LoadWordList(kOptions.wordDictPath);
+	WordList mixedWords = kWords;
+	for (std::size_t index = 0; index < kWords.size() / 3; ++index)
+	{
+		mixedWords.emplace_back(kFOREIGN_WORDS[index % std::size(kFOREIGN_WORDS)]);
+	}
+
+	const std::pair<std::string_view, WordList> kCorpora[] = {
+		{ "ASCII", MakeRows(kWords, kNUM_ROWS) },
+		{ "mixed-script", MakeRows(mixedWords, kNUM_ROWS) }
+	};
+	auto pDictionary = std::make_shared<HashDictionary>(kOptions.wordDictPath);
+	for (const std::string_view kWord : kFOREIGN_WORDS)
+	{
+		pDictionary->Insert(kWord);
+	}
+
+	for (const auto &[kName, kRows] : kCorpora)
+	{
+		std::string text;
+		for (const auto &kRow : kRows)
+		{
+			text += kRow;
+			text += '\n';
+		}
+
+		std::size_t numRuns = 0;
+		double seconds = Measure([&]() { numRuns = TokenizeReference(text).size(); });
+		ReportBytes(std::format("{}: tokenize, decoding", kName), text.size(), seconds);
+		const std::size_t kNumReferenceRuns = numRuns;
+		numRuns = 0;
+		seconds = Measure([&]()
+		{
+			WordTokenizer::ForEachRun(text, [&numRuns](const WordRange &) { ++numRuns; });
+		});
+		ReportBytes(std::format("{}: tokenize, bulk", kName), text.size(), seconds);
+		std::cout << std::format("  {} words, counts {}\n", numRuns, numRuns == kNumReferenceRuns ? "match" : "differ");
+
+		SpellCheckVisitor charVisitor(pDictionary);
+		IVisitor &charBase = charVisitor;
+		seconds = Measure([&]()
+		{
+			for (const char kCh : text)
+			{
+				charBase.VVisitCharacter(kCh);
+			}
+		});
+		ReportBytes(std::format("{}: VVisitCharacter", kName), text.size(), seconds);
+
+		SpellCheckVisitor textVisitor(pDictionary);
+		IVisitor &textBase = textVisitor;
+		seconds = Measure([&]() { textBase.VVisitText(text); });
+		ReportBytes(std::format("{}: VVisitText", kName), text.size(), seconds);
+		std::cout << std::format("  {} misspellings, results {}\n", textVisitor.GetMisspellings().size(),
+								 charVisitor.GetMisspellings() == textVisitor.GetMisspellings() ? "match" : "differ");
+	}
+	// Random text with invalid bytes, split into random chunks so sequences straddle VVisitText calls.
+	std::mt19937 rng(7);
+	std::size_t numTokenizeMismatches = 0;
+	std::size_t numVisitMismatches = 0;
+	for (std::size_t testCase = 0; testCase < kNUM_NOISE_CASES; ++testCase)
+	{
+		const std::string kText = MakeNoise(rng, 1 + rng() % 300);
+		WordRangeVector runs;
+		WordTokenizer::ForEachRun(kText, [&runs](const WordRange &kRange) { runs.push_back(kRange); });
+		numTokenizeMismatches += runs != TokenizeReference(kText);
+
+		SpellCheckVisitor charVisitor(pDictionary);
+		SpellCheckVisitor chunkVisitor(pDictionary);
+		for (const char kCh : kText)
+		{
+			charVisitor.VVisitCharacter(kCh);
+		}
+
+		for (std::size_t offset = 0; offset < kText.size(); )
+		{
+			const std::size_t kChunkSize = std::min<std::size_t>(1 + rng() % 9, kText.size() - offset);
+			chunkVisitor.VVisitText(std::span<const char>(kText).subspan(offset, kChunkSize));
+			offset += kChunkSize;
+		}
+
+		charVisitor.VVisitRow();
+		chunkVisitor.VVisitRow();
+		numVisitMismatches += charVisitor.GetMisspellings() != chunkVisitor.GetMisspellings();
+	}
+
+	std::cout << std::format("  Random UTF-8: {} cases, {} tokenizer & {} visitor mismatches\n", kNUM_NOISE_CASES,
+							 numTokenizeMismatches, numVisitMismatches);
+	// Listed foreign words are accepted capitalized & in all caps.
+	constexpr std::string_view kCASE_FORMS[] = { "Café", "CAFÉ", "NAÏVE", "Über", "ÜBER", "STRAßE", "ÆRØ", "ŁÓDŹ" };
+	const auto kNumAccepted = std::ranges::count_if(kCASE_FORMS, [&](std::string_view word)
+	{
+		return pDictionary->VContains(word);
+	});
+	std::cout << std::format("  Case forms accepted: {}/{}\n", kNumAccepted, std::size(kCASE_FORMS));
+}
+
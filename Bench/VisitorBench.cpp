@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * @file   VisitorBench.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Visitor text throughput benchmark.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Bench.hpp"
+
+void Lexi::Bench::RunVisitorBench(const Options &kOptions)
+{
+	constexpr std::size_t kNUM_ROWS = 50'000;
+	constexpr std::size_t kCHUNK_SIZE = 4096;
+
+	std::string text;
+	for (const auto &kRow : MakeRows(LoadWordList(kOptions.wordDictPath), kNUM_ROWS))
+	{
+		text += kRow;
+		text += '\n';
+	}
+	// Tokenizing alone: scalar per-character loop vs 64-byte masks.
+	std::size_t numWords = 0;
+	double seconds = Measure([&]()
+	{
+		bool bInWord = false;
+		for (const char kCh : text)
+		{
+			const bool kbWordChar = WordTokenizer::IsWordChar(kCh);
+			numWords += kbWordChar && !bInWord;
+			bInWord = kbWordChar;
+		}
+	});
+	ReportBytes("Tokenize, per character", text.size(), seconds);
+	const std::size_t kNumScalarWords = numWords;
+	numWords = 0;
+	seconds = Measure([&]()
+	{
+		WordTokenizer::ForEachRun(text, [&numWords](const WordRange &) { ++numWords; });
+	});
+	ReportBytes("Tokenize, bulk", text.size(), seconds);
+	std::cout << std::format("  {} words, counts {}\n", numWords, numWords == kNumScalarWords ? "match" : "differ");
+	// Through the visitor interface (dictionary lookups included).
+	SpellCheckVisitor charVisitor(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+	IVisitor &charBase = charVisitor;
+	seconds = Measure([&]()
+	{
+		for (const char kCh : text)
+		{
+			charBase.VVisitCharacter(kCh);
+		}
+	});
+	ReportBytes("VVisitCharacter per character", text.size(), seconds);
+
+	SpellCheckVisitor textVisitor(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+	IVisitor &textBase = textVisitor;
+	seconds = Measure([&]() { textBase.VVisitText(text); });
+	ReportBytes("VVisitText, whole document", text.size(), seconds);
+
+	SpellCheckVisitor chunkVisitor(std::make_unique<HashDictionary>(kOptions.wordDictPath));
+	IVisitor &chunkBase = chunkVisitor;
+	seconds = Measure([&]()
+	{
+		for (std::size_t offset = 0; offset < text.size(); offset += kCHUNK_SIZE)
+		{
+			chunkBase.VVisitText(std::span<const char>(text).subspan(offset, std::min(kCHUNK_SIZE, text.size() - offset)));
+		}
+	});
+	ReportBytes("VVisitText, 4 KB chunks", text.size(), seconds);
+
+	const bool kbSame = charVisitor.GetMisspellings() == textVisitor.GetMisspellings() &&
+						charVisitor.GetMisspellings() == chunkVisitor.GetMisspellings();
+	std::cout << std::format("  {} misspellings, results {}\n", textVisitor.GetMisspellings().size(),
+							 kbSame ? "match" : "differ");
+}
+
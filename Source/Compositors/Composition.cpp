@@ -0,0 +1,441 @@
+/*******************************************************************************
+ * @file   Composition.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Incrementally composed document layout.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Composition.hpp"
+
+using Lexi::Composition;
+
+Composition::Composition(UniqueICompositorPtr pCompositor, std::int32_t lineWidth, std::int32_t pageHeight,
+						 std::int32_t minRowHeight)
+	: m_pCompositor(std::move(pCompositor)),
+	  m_paragraphs{},
+	  m_lineWidth(lineWidth),
+	  m_pageHeight(pageHeight),
+	  m_minRowHeight(minRowHeight),
+	  m_firstMoved(kNONE),
+	  m_lastDirty(kNONE),
+	  m_lineStarts{},
+	  m_taskCompositors{},
+	  m_dirtyParagraphs{},
+	  m_stats{}
+{
+	LEXI_THROW_IF(!m_pCompositor, "Composition needs a compositor!");
+	LEXI_THROW_IF(m_pageHeight < 0, "Page height can't be negative!");
+}
+
+void Composition::Assign(std::string_view text, CharacterPool &pool, StyleId style)
+{
+	m_paragraphs.clear();
+	std::vector<const IGlyph *> glyphs;
+	bool bMoreLines = true;
+	while (bMoreLines)
+	{
+		const std::size_t kEnd = text.find('\n');
+		bMoreLines = kEnd != std::string_view::npos;
+		std::string_view line = text.substr(0, kEnd);
+		text.remove_prefix(bMoreLines ? kEnd + 1 : text.size());
+
+		glyphs.clear();
+		while (!line.empty())
+		{
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(line);
+			glyphs.push_back(&pool.Get(kCodePoint.value, style));
+			line.remove_prefix(kCodePoint.length);
+		}
+
+		m_paragraphs.push_back(Paragraph{ glyphs, {}, {}, {}, 0, 0, true });
+	}
+
+	MarkAllDirty();
+}
+
+void Composition::InsertParagraph(std::size_t index, std::span<const IGlyph *const> glyphs)
+{
+	LEXI_THROW_IF(index > m_paragraphs.size(), "Paragraph insert position is out of range!");
+	m_paragraphs.insert(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(index),
+						Paragraph{ { glyphs.begin(), glyphs.end() }, {}, {}, {}, 0, 0, true });
+	if (m_lastDirty != kNONE && m_lastDirty >= index)
+	{
+		++m_lastDirty;
+	}
+
+	MarkDirty(index);
+}
+
+void Composition::EraseParagraph(std::size_t index)
+{
+	LEXI_THROW_IF(index >= m_paragraphs.size(), "Paragraph index is out of range!");
+	m_paragraphs.erase(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(index));
+	if (m_lastDirty != kNONE && m_lastDirty > index)
+	{
+		--m_lastDirty;
+	}
+
+	// The paragraphs below move up.
+	m_firstMoved = std::min(m_firstMoved, index);
+	if (m_firstMoved >= m_paragraphs.size())
+	{
+		// The last paragraph went & everything above is in place.
+		m_firstMoved = kNONE;
+		m_lastDirty = kNONE;
+	}
+	else if (m_lastDirty != kNONE)
+	{
+		m_lastDirty = std::min(m_lastDirty, m_paragraphs.size() - 1);
+	}
+}
+
+void Composition::InsertGlyph(std::size_t paragraph, std::size_t position, const IGlyph &kGlyph)
+{
+	LEXI_THROW_IF(paragraph >= m_paragraphs.size(), "Paragraph index is out of range!");
+	auto &glyphs = m_paragraphs[paragraph].glyphs;
+	LEXI_THROW_IF(position > glyphs.size(), "Glyph insert position is out of range!");
+	glyphs.insert(glyphs.begin() + static_cast<std::ptrdiff_t>(position), &kGlyph);
+	MarkDirty(paragraph);
+}
+
+void Composition::EraseGlyph(std::size_t paragraph, std::size_t position)
+{
+	LEXI_THROW_IF(paragraph >= m_paragraphs.size(), "Paragraph index is out of range!");
+	auto &glyphs = m_paragraphs[paragraph].glyphs;
+	LEXI_THROW_IF(position >= glyphs.size(), "Glyph position is out of range!");
+	glyphs.erase(glyphs.begin() + static_cast<std::ptrdiff_t>(position));
+	MarkDirty(paragraph);
+}
+
+void Composition::Compose(void)
+{
+	ComposePass(nullptr);
+}
+
+void Composition::Compose(ThreadPool &threadPool)
+{
+	ComposePass(&threadPool);
+}
+
+void Composition::SetCompositor(UniqueICompositorPtr pCompositor)
+{
+	LEXI_THROW_IF(!pCompositor, "Composition needs a compositor!");
+	m_pCompositor = std::move(pCompositor);
+	m_taskCompositors.clear();
+	MarkAllDirty();
+}
+
+void Composition::SetLineWidth(std::int32_t lineWidth)
+{
+	if (lineWidth != m_lineWidth)
+	{
+		m_lineWidth = lineWidth;
+		MarkAllDirty();
+	}
+}
+
+const Lexi::ICompositor &Composition::GetCompositor(void) const noexcept
+{
+	return *m_pCompositor;
+}
+
+std::int32_t Composition::GetLineWidth(void) const noexcept
+{
+	return m_lineWidth;
+}
+
+std::size_t Composition::GetNumParagraphs(void) const noexcept
+{
+	return m_paragraphs.size();
+}
+
+std::span<const Lexi::IGlyph *const> Composition::GetGlyphs(std::size_t paragraph) const
+{
+	LEXI_THROW_IF(paragraph >= m_paragraphs.size(), "Paragraph index is out of range!");
+	return m_paragraphs[paragraph].glyphs;
+}
+
+std::span<const Lexi::Row> Composition::GetRows(std::size_t paragraph) const
+{
+	LEXI_THROW_IF(paragraph >= m_paragraphs.size(), "Paragraph index is out of range!");
+	return m_paragraphs[paragraph].rows;
+}
+
+std::int32_t Composition::GetHeight(void) const noexcept
+{
+	return m_paragraphs.empty() ? 0 : m_paragraphs.back().bottom;
+}
+
+std::size_t Composition::GetNumPages(void) const noexcept
+{
+	if (m_pageHeight == 0)
+	{
+		return 1;
+	}
+
+	return static_cast<std::size_t>(std::max((GetHeight() + m_pageHeight - 1) / m_pageHeight, 1));
+}
+
+bool Composition::IsDirty(void) const noexcept
+{
+	return m_firstMoved != kNONE;
+}
+
+const Composition::Stats &Composition::GetStats(void) const noexcept
+{
+	return m_stats;
+}
+
+Lexi::GlyphArena::Stats Composition::GetRowMemoryStats(void) const noexcept
+{
+	GlyphArena::Stats stats{};
+	for (const Paragraph &kParagraph : m_paragraphs)
+	{
+		if (kParagraph.pArena)
+		{
+			const GlyphArena::Stats kArenaStats = kParagraph.pArena->GetStats();
+			stats.numAllocations += kArenaStats.numAllocations;
+			stats.numDeallocations += kArenaStats.numDeallocations;
+			stats.numBytesAllocated += kArenaStats.numBytesAllocated;
+			stats.numBytesReserved += kArenaStats.numBytesReserved;
+			stats.numChunks += kArenaStats.numChunks;
+		}
+	}
+
+	return stats;
+}
+
+void Composition::MarkDirty(std::size_t paragraph)
+{
+	m_paragraphs[paragraph].bDirty = true;
+	m_firstMoved = std::min(m_firstMoved, paragraph);
+	m_lastDirty = (m_lastDirty == kNONE) ? paragraph : std::max(m_lastDirty, paragraph);
+}
+
+void Composition::MarkAllDirty(void)
+{
+	if (m_paragraphs.empty())
+	{
+		return;
+	}
+
+	for (Paragraph &paragraph : m_paragraphs)
+	{
+		paragraph.bDirty = true;
+	}
+
+	m_firstMoved = 0;
+	m_lastDirty = m_paragraphs.size() - 1;
+}
+
+void Composition::ComposePass(ThreadPool *pThreadPool)
+{
+	if (m_firstMoved == kNONE)
+	{
+		return;
+	}
+
+	const auto kStart = std::chrono::steady_clock::now();
+	// Break the dirty paragraphs up front if it's worth it, then place everything in order.
+	const bool kbBuilt = pThreadPool != nullptr && BuildRowsInParallel(*pThreadPool);
+	std::int32_t y = (m_firstMoved == 0) ? 0 : m_paragraphs[m_firstMoved - 1].bottom;
+	for (std::size_t index = m_firstMoved; index < m_paragraphs.size(); ++index)
+	{
+		Paragraph &paragraph = m_paragraphs[index];
+		if (paragraph.bDirty)
+		{
+			if (!kbBuilt)
+			{
+				BuildRows(paragraph, m_lineWidth, *m_pCompositor, m_lineStarts);
+			}
+
+			paragraph.bDirty = false;
+			++m_stats.numParagraphsComposed;
+			m_stats.numRowsBuilt += paragraph.rows.size();
+		}
+		else if (paragraph.top == y && (m_lastDirty == kNONE || index > m_lastDirty))
+		{
+			// Nothing changed from here down.
+			break;
+		}
+		else
+		{
+			++m_stats.numParagraphsMoved;
+		}
+
+		Place(paragraph, y);
+		y = paragraph.bottom;
+	}
+
+	m_firstMoved = kNONE;
+	m_lastDirty = kNONE;
+
+	const double kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+	++m_stats.numPasses;
+	m_stats.numParallelPasses += kbBuilt ? 1 : 0;
+	m_stats.lastPassSeconds = kSeconds;
+	m_stats.maxPassSeconds = std::max(m_stats.maxPassSeconds, kSeconds);
+	m_stats.totalPassSeconds += kSeconds;
+}
+
+bool Composition::BuildRowsInParallel(ThreadPool &threadPool)
+{
+	m_dirtyParagraphs.clear();
+	const std::size_t kEnd = (m_lastDirty == kNONE) ? 0 : std::min(m_lastDirty + 1, m_paragraphs.size());
+	for (std::size_t index = m_firstMoved; index < kEnd; ++index)
+	{
+		if (m_paragraphs[index].bDirty)
+		{
+			m_dirtyParagraphs.push_back(index);
+		}
+	}
+
+	const std::size_t kNumChunks = (m_dirtyParagraphs.size() + kPARAGRAPHS_PER_CHUNK - 1) / kPARAGRAPHS_PER_CHUNK;
+	if (m_dirtyParagraphs.size() < kMIN_PARALLEL_PARAGRAPHS)
+	{
+		return false;
+	}
+
+	// Compositors keep scratch space, so every task gets a clone of its own; the calling thread uses the original.
+	const std::size_t kNumTasks = std::min(threadPool.GetNumThreads(), kNumChunks - 1);
+	while (m_taskCompositors.size() < kNumTasks)
+	{
+		m_taskCompositors.emplace_back(m_pCompositor->VClone(), ICompositor::LineStarts{});
+	}
+
+	// Tasks claim chunks as they go, so a few long paragraphs don't hold up one task.
+	const auto pPass = std::make_shared<ParallelPass>();
+	pPass->paragraphs = m_paragraphs;
+	pPass->dirtyParagraphs = m_dirtyParagraphs;
+	pPass->lineWidth = m_lineWidth;
+	pPass->numChunks = kNumChunks;
+	for (std::size_t task = 0; task < kNumTasks; ++task)
+	{
+		auto &[pCompositor, lineStarts] = m_taskCompositors[task];
+		threadPool.Submit([pPass, pCompositor = pCompositor.get(), pLineStarts = &lineStarts]()
+		{
+			BuildChunks(*pPass, *pCompositor, *pLineStarts);
+		});
+	}
+
+	// A task still queued when the chunks run out just finds nothing left to claim.
+	BuildChunks(*pPass, *m_pCompositor, m_lineStarts);
+	std::unique_lock<std::mutex> lock(pPass->mutex);
+	pPass->doneCondition.wait(lock, [&kPass = *pPass]() { return kPass.numDone == kPass.numChunks; });
+	if (pPass->pException)
+	{
+		std::rethrow_exception(pPass->pException);
+	}
+
+	return true;
+}
+
+void Composition::BuildChunks(ParallelPass &pass, ICompositor &compositor, ICompositor::LineStarts &lineStarts)
+{
+	for (std::size_t chunk = pass.nextChunk++; chunk < pass.numChunks; chunk = pass.nextChunk++)
+	{
+		std::exception_ptr pException;
+		if (!pass.bFailed)
+		{
+			try
+			{
+				const std::size_t kFirst = chunk * kPARAGRAPHS_PER_CHUNK;
+				const std::size_t kLast = std::min(kFirst + kPARAGRAPHS_PER_CHUNK, pass.dirtyParagraphs.size());
+				for (std::size_t index = kFirst; index < kLast; ++index)
+				{
+					BuildRows(pass.paragraphs[pass.dirtyParagraphs[index]], pass.lineWidth, compositor, lineStarts);
+				}
+			}
+			catch (...)
+			{
+				pException = std::current_exception();
+				pass.bFailed = true;
+			}
+		}
+
+		std::lock_guard<std::mutex> lockGuard(pass.mutex);
+		if (pException && !pass.pException)
+		{
+			pass.pException = pException;
+		}
+
+		if (++pass.numDone == pass.numChunks)
+		{
+			pass.doneCondition.notify_all();
+		}
+	}
+}
+
+void Composition::BuildRows(Paragraph &paragraph, std::int32_t lineWidth, ICompositor &compositor,
+							ICompositor::LineStarts &lineStarts)
+{
+	compositor.VCompose(paragraph.glyphs, lineWidth, lineStarts);
+	lineStarts.push_back(static_cast<std::uint32_t>(paragraph.glyphs.size()));
+
+	// The old rows are dropped wholesale, the new ones reuse their memory.
+	paragraph.rows = {};
+	if (paragraph.pArena)
+	{
+		paragraph.pArena->Reset();
+	}
+	else
+	{
+		paragraph.pArena = std::make_unique<GlyphArena>(kPARAGRAPH_ARENA_SIZE);
+	}
+
+	paragraph.rows = paragraph.pArena->CreateArray<Row>(lineStarts.size() - 1);
+	for (std::size_t line = 0; line + 1 < lineStarts.size(); ++line)
+	{
+		Row &row = paragraph.rows[line];
+		row.Reserve(lineStarts[line + 1] - lineStarts[line]);
+		for (std::size_t index = lineStarts[line]; index < lineStarts[line + 1]; ++index)
+		{
+			row.Append(*paragraph.glyphs[index]);
+		}
+	}
+}
+
+void Composition::Place(Paragraph &paragraph, std::int32_t y) const noexcept
+{
+	paragraph.top = y;
+	paragraph.rowYs.resize(paragraph.rows.size());
+	for (std::size_t index = 0; index < paragraph.rows.size(); ++index)
+	{
+		const std::int32_t kHeight = std::max(paragraph.rows[index].VGetHeight(), m_minRowHeight);
+		if (m_pageHeight > 0 && kHeight <= m_pageHeight && y / m_pageHeight != (y + kHeight - 1) / m_pageHeight)
+		{
+			// Rows don't straddle pages, this one starts the next.
+			y = (y / m_pageHeight + 1) * m_pageHeight;
+		}
+
+		paragraph.rowYs[index] = y;
+		y += kHeight;
+	}
+
+	paragraph.bottom = y;
+}
+
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * @file   Composition.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Incrementally composed document layout.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_COMPOSITION_HPP
+#define LEXI_COMPOSITION_HPP
+
+namespace Lexi
+{
+	class Composition;
+	LEXI_DECLARE_PTR(Composition);
+
+	/**
+	 * Document laid out as paragraphs of rows (GoF Composition).
+	 *
+	 * Paragraphs are broken into Rows by an ICompositor & stacked onto pages;
+	 * a row never straddles two pages. Edits only mark their paragraph
+	 * dirty, Compose() then breaks just the dirty paragraphs again & moves
+	 * the ones below them, stopping at the first paragraph whose position
+	 * didn't change. A keystroke thus costs one paragraph's line breaking
+	 * plus, if its height changed, repositioning what follows.
+	 *
+	 * Line breaking is independent per paragraph, only placement depends on
+	 * what comes before. Compose(ThreadPool &) therefore breaks the dirty
+	 * paragraphs on the pool, each task with a clone of the compositor, &
+	 * then places them in one sequential pass; this pays off when many
+	 * paragraphs are dirty, e.g. after opening a document, a resize or a
+	 * font change. The calling thread breaks paragraphs too & only waits
+	 * for those already being broken, never for tasks still queued behind
+	 * other work on the pool.
+	 *
+	 * Glyphs are referenced, not owned (see CharacterPool). The rows of each
+	 * paragraph live in a GlyphArena of its own that is reset whenever they
+	 * are broken again: a relayout reuses the memory of the rows it replaces
+	 * instead of growing, & tasks breaking paragraphs in parallel never
+	 * share an arena.
+	 */
+	class Composition
+	{
+	public:
+		//! Fewest dirty paragraphs worth breaking on a thread pool.
+		static constexpr std::size_t kMIN_PARALLEL_PARAGRAPHS = 64;
+		//! Paragraphs a layout task claims at a time.
+		static constexpr std::size_t kPARAGRAPHS_PER_CHUNK = 16;
+		//! First chunk of a paragraph's arena, enough for a few rows.
+		static constexpr std::size_t kPARAGRAPH_ARENA_SIZE = 1024;
+
+		//! Work counters & timings of Compose() passes.
+		struct Stats
+		{
+			std::uint64_t numPasses; //!< Compose() calls that had work to do
+			std::uint64_t numParallelPasses; //!< Passes that broke paragraphs on a thread pool
+			std::uint64_t numParagraphsComposed; //!< Paragraphs broken into rows
+			std::uint64_t numParagraphsMoved; //!< Paragraphs only moved by a change above them
+			std::uint64_t numRowsBuilt;
+			double lastPassSeconds;
+			double maxPassSeconds;
+			double totalPassSeconds;
+		};
+	private:
+		struct Paragraph
+		{
+			std::vector<const IGlyph *> glyphs;
+			UniqueGlyphArenaPtr pArena; //!< Memory of the rows (created by the first BuildRows())
+			std::span<Row> rows; //!< Allocated from pArena
+			std::vector<std::int32_t> rowYs; //!< Top of each row
+			std::int32_t top; //!< Where the paragraph was placed (its first row may move to the next page)
+			std::int32_t bottom; //!< Bottom of the last row
+			bool bDirty; //!< Whether or not the rows are out of date
+		};
+		//! State of one parallel pass, shared with tasks that may start after it's over.
+		struct ParallelPass
+		{
+			std::span<Paragraph> paragraphs;
+			std::span<const std::size_t> dirtyParagraphs;
+			std::int32_t lineWidth;
+			std::size_t numChunks;
+			std::atomic<std::size_t> nextChunk; //!< Next chunk to claim
+			std::atomic<bool> bFailed; //!< Skip the remaining chunks after an exception
+			std::mutex mutex; //!< Guards numDone & pException
+			std::condition_variable doneCondition;
+			std::size_t numDone; //!< Chunks broken (or skipped)
+			std::exception_ptr pException; //!< First exception of any chunk
+		};
+		static constexpr std::size_t kNONE = std::numeric_limits<std::size_t>::max();
+
+		UniqueICompositorPtr m_pCompositor;
+		std::vector<Paragraph> m_paragraphs;
+		std::int32_t m_lineWidth;
+		std::int32_t m_pageHeight; //!< Zero for a single endless page
+		std::int32_t m_minRowHeight; //!< Height of empty rows
+		std::size_t m_firstMoved; //!< First paragraph that may have to move (kNONE if none)
+		std::size_t m_lastDirty; //!< Last paragraph that may be dirty (kNONE if none)
+		ICompositor::LineStarts m_lineStarts; //!< Scratch space for the compositor
+		//! Compositor clones & their scratch space, one per parallel layout task.
+		std::vector<std::pair<UniqueICompositorPtr, ICompositor::LineStarts>> m_taskCompositors;
+		std::vector<std::size_t> m_dirtyParagraphs; //!< Scratch space for parallel passes
+		Stats m_stats;
+	public:
+		Composition(UniqueICompositorPtr pCompositor, std::int32_t lineWidth, std::int32_t pageHeight,
+					std::int32_t minRowHeight);
+
+		//! Replace the document with UTF-8 text, one paragraph per line.
+		void Assign(std::string_view text, CharacterPool &pool, StyleId style);
+		void InsertParagraph(std::size_t index, std::span<const IGlyph *const> glyphs = {});
+		void EraseParagraph(std::size_t index);
+		void InsertGlyph(std::size_t paragraph, std::size_t position, const IGlyph &kGlyph);
+		void EraseGlyph(std::size_t paragraph, std::size_t position);
+		//! Bring the rows & their positions up to date with the edits so far.
+		void Compose(void);
+		//! Same as Compose(), breaking the dirty paragraphs on threadPool when there are enough.
+		void Compose(ThreadPool &threadPool);
+		/**
+		 * Invoke func(const Row &, Point) for the rows overlapping [top, bottom).
+		 *
+		 * Rows & positions are those of the last Compose().
+		 */
+		template <typename Func>
+		void ForEachRow(std::int32_t top, std::int32_t bottom, Func &&func) const;
+		//! Changing the strategy or line width lays out the whole document again.
+		void SetCompositor(UniqueICompositorPtr pCompositor);
+		void SetLineWidth(std::int32_t lineWidth);
+		// Accessors:
+		const ICompositor &GetCompositor(void) const noexcept;
+		std::int32_t GetLineWidth(void) const noexcept;
+		std::size_t GetNumParagraphs(void) const noexcept;
+		std::span<const IGlyph *const> GetGlyphs(std::size_t paragraph) const;
+		std::span<const Row> GetRows(std::size_t paragraph) const;
+		std::int32_t GetHeight(void) const noexcept;
+		std::size_t GetNumPages(void) const noexcept;
+		//! Whether or not there are edits Compose() hasn't processed.
+		bool IsDirty(void) const noexcept;
+		const Stats &GetStats(void) const noexcept;
+		//! Retrieve the memory used by the rows, summed over the paragraphs' arenas.
+		GlyphArena::Stats GetRowMemoryStats(void) const noexcept;
+	private:
+		void MarkDirty(std::size_t paragraph);
+		void MarkAllDirty(void);
+		//! Run a pass, breaking the dirty paragraphs first on pThreadPool if it's given.
+		void ComposePass(ThreadPool *pThreadPool);
+		//! Break the dirty paragraphs on threadPool, false if there were too few to bother.
+		bool BuildRowsInParallel(ThreadPool &threadPool);
+		//! Claim & break chunks of the pass until none are left.
+		static void BuildChunks(ParallelPass &pass, ICompositor &compositor, ICompositor::LineStarts &lineStarts);
+		static void BuildRows(Paragraph &paragraph, std::int32_t lineWidth, ICompositor &compositor,
+							  ICompositor::LineStarts &lineStarts);
+		//! Position the rows of a paragraph from y down.
+		void Place(Paragraph &paragraph, std::int32_t y) const noexcept;
+	};
+
+	template <typename Func>
+	inline void Composition::ForEachRow(std::int32_t top, std::int32_t bottom, Func &&func) const
+	{
+		auto iter = std::ranges::partition_point(m_paragraphs, [top](const Paragraph &kParagraph)
+		{
+			return kParagraph.bottom <= top;
+		});
+		for (; iter != m_paragraphs.end() && iter->top < bottom; ++iter)
+		{
+			for (std::size_t index = 0; index < iter->rows.size(); ++index)
+			{
+				const std::int32_t kY = iter->rowYs[index];
+				const Row &kRow = iter->rows[index];
+				if (kY >= bottom)
+				{
+					return;
+				}
+				else if (kY + std::max(kRow.VGetHeight(), m_minRowHeight) > top)
+				{
+					func(kRow, Point{ 0, kY });
+				}
+			}
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_COMPOSITION_HPP */
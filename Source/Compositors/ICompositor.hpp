@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * @file   ICompositor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Line breaking strategy interface.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_ICOMPOSITOR_HPP
+#define LEXI_ICOMPOSITOR_HPP
+
+namespace Lexi
+{
+	class ICompositor;
+	LEXI_DECLARE_PTR(ICompositor);
+
+	/**
+	 * Interface for line breaking strategies (GoF Strategy, see Composition).
+	 *
+	 * A paragraph is a sequence of glyphs; lines may only break after a run
+	 * of space characters, which may hang past the end of the line. A word
+	 * wider than a line gets a line of its own.
+	 */
+	class ICompositor
+	{
+	public:
+		//! Index of the first glyph of each line.
+		using LineStarts = std::vector<std::uint32_t>;
+		//! Unbreakable run of glyphs & the spaces following it.
+		struct Word
+		{
+			std::uint32_t start; //!< Index of the first glyph
+			std::int32_t width; //!< Width without the spaces
+			std::int32_t spaceWidth; //!< Width of the spaces after the word
+		};
+
+		virtual ~ICompositor(void) = default;
+		/**
+		 * Break a paragraph into lines of at most lineWidth pixels.
+		 *
+		 * lineStarts is replaced & always starts with 0, even for an empty
+		 * paragraph.
+		 */
+		virtual void VCompose(std::span<const IGlyph *const> glyphs, std::int32_t lineWidth, LineStarts &lineStarts) = 0;
+		//! Create a compositor of the same strategy with scratch space of its own (one per layout thread).
+		virtual UniqueICompositorPtr VClone(void) const = 0;
+		//! Retrieve the name of the strategy (for logging & configuration).
+		virtual std::string_view VGetName(void) const noexcept = 0;
+	protected:
+		//! Split a paragraph into words, leading spaces count as an empty first word.
+		static void SplitWords(std::span<const IGlyph *const> glyphs, std::vector<Word> &words);
+	};
+
+	inline void ICompositor::SplitWords(std::span<const IGlyph *const> glyphs, std::vector<Word> &words)
+	{
+		words.clear();
+		bool bInSpaces = true;
+		for (std::size_t index = 0; index < glyphs.size(); ++index)
+		{
+			const IGlyph &kGlyph = *glyphs[index];
+			const bool kbSpace = kGlyph.GetKind() == GlyphKind::kCharacter &&
+								 static_cast<const Character &>(kGlyph).GetCodePoint() == U' ';
+			if (words.empty() || (bInSpaces && !kbSpace))
+			{
+				words.push_back(Word{ static_cast<std::uint32_t>(index), 0, 0 });
+			}
+
+			(kbSpace ? words.back().spaceWidth : words.back().width) += kGlyph.VGetWidth();
+			bInSpaces = kbSpace;
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_ICOMPOSITOR_HPP */
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * @file   SimpleCompositor.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Greedy line breaking.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "SimpleCompositor.hpp"
+
+using Lexi::SimpleCompositor;
+
+SimpleCompositor::SimpleCompositor(void)
+	: m_words{}
+{
+}
+
+void SimpleCompositor::VCompose(std::span<const IGlyph *const> glyphs, std::int32_t lineWidth, LineStarts &lineStarts)
+{
+	lineStarts.assign(1, 0);
+	SplitWords(glyphs, m_words);
+
+	std::int32_t x = 0;
+	for (std::size_t index = 0; index < m_words.size(); ++index)
+	{
+		const Word &kWord = m_words[index];
+		if (index > 0 && x > 0 && x + kWord.width > lineWidth)
+		{
+			lineStarts.push_back(kWord.start);
+			x = 0;
+		}
+
+		x += kWord.width + kWord.spaceWidth;
+	}
+}
+
+Lexi::UniqueICompositorPtr SimpleCompositor::VClone(void) const
+{
+	return std::make_unique<SimpleCompositor>();
+}
+
+std::string_view SimpleCompositor::VGetName(void) const noexcept
+{
+	return kNAME;
+}
+
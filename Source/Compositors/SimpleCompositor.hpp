@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * @file   SimpleCompositor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Greedy line breaking.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_SIMPLECOMPOSITOR_HPP
+#define LEXI_SIMPLECOMPOSITOR_HPP
+
+namespace Lexi
+{
+	class SimpleCompositor;
+	LEXI_DECLARE_PTR(SimpleCompositor);
+
+	//! Greedy line breaking: each line takes as many words as fit, in linear time.
+	class SimpleCompositor final : public ICompositor
+	{
+	public:
+		static constexpr std::string_view kNAME = "simple";
+	private:
+		std::vector<Word> m_words; //!< Scratch space, reused between paragraphs
+	public:
+		SimpleCompositor(void);
+
+		void VCompose(std::span<const IGlyph *const> glyphs, std::int32_t lineWidth, LineStarts &lineStarts) override;
+		UniqueICompositorPtr VClone(void) const override;
+		std::string_view VGetName(void) const noexcept override;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_SIMPLECOMPOSITOR_HPP */
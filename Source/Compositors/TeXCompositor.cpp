@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * @file   TeXCompositor.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Knuth-Plass (total fit) line breaking.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "TeXCompositor.hpp"
+
+using Lexi::TeXCompositor;
+
+TeXCompositor::TeXCompositor(void)
+	: m_words{},
+	  m_wordWidths{},
+	  m_spaceWidths{},
+	  m_demerits{},
+	  m_previousBreaks{}
+{
+}
+
+void TeXCompositor::VCompose(std::span<const IGlyph *const> glyphs, std::int32_t lineWidth, LineStarts &lineStarts)
+{
+	lineStarts.assign(1, 0);
+	SplitWords(glyphs, m_words);
+	const std::size_t kNumWords = m_words.size();
+	if (kNumWords < 2)
+	{
+		return;
+	}
+
+	m_wordWidths.assign(1, 0);
+	m_spaceWidths.assign(1, 0);
+	for (const Word &kWord : m_words)
+	{
+		m_wordWidths.push_back(m_wordWidths.back() + kWord.width);
+		m_spaceWidths.push_back(m_spaceWidths.back() + kWord.spaceWidth);
+	}
+
+	// m_demerits[last] is the best total for words [0, last) ending a line before word last.
+	m_demerits.assign(kNumWords + 1, std::numeric_limits<double>::infinity());
+	m_previousBreaks.assign(kNumWords + 1, 0);
+	m_demerits[0] = 0.0;
+	for (std::size_t last = 1; last <= kNumWords; ++last)
+	{
+		for (std::size_t first = last; first-- > 0; )
+		{
+			const double kLineDemerits = GetLineDemerits(first, last, lineWidth);
+			if (kLineDemerits < 0.0)
+			{
+				// Starting the line any earlier only makes it wider.
+				break;
+			}
+
+			const double kTotal = m_demerits[first] + kLineDemerits;
+			if (kTotal < m_demerits[last])
+			{
+				m_demerits[last] = kTotal;
+				m_previousBreaks[last] = static_cast<std::uint32_t>(first);
+			}
+		}
+	}
+
+	for (std::size_t last = kNumWords; m_previousBreaks[last] > 0; last = m_previousBreaks[last])
+	{
+		lineStarts.push_back(m_words[m_previousBreaks[last]].start);
+	}
+
+	std::reverse(lineStarts.begin() + 1, lineStarts.end());
+}
+
+Lexi::UniqueICompositorPtr TeXCompositor::VClone(void) const
+{
+	return std::make_unique<TeXCompositor>();
+}
+
+std::string_view TeXCompositor::VGetName(void) const noexcept
+{
+	return kNAME;
+}
+
+double TeXCompositor::GetLineDemerits(std::size_t first, std::size_t last, std::int32_t lineWidth) const noexcept
+{
+	// Spaces inside the line stretch & shrink, the ones after its last word hang.
+	const auto kSpaces = static_cast<double>(m_spaceWidths[last - 1] - m_spaceWidths[first]);
+	const auto kNatural = static_cast<double>(m_wordWidths[last] - m_wordWidths[first]) + kSpaces;
+	const double kShrink = kSpaces / 3.0;
+	const double kStretch = kSpaces / 2.0;
+	const auto kWidth = static_cast<double>(lineWidth);
+	if (kNatural - kShrink > kWidth)
+	{
+		return (last - first == 1) ? kOVERFULL_DEMERITS : -1.0;
+	}
+
+	double badness = 0.0;
+	if (kNatural > kWidth)
+	{
+		const double kRatio = (kNatural - kWidth) / kShrink;
+		badness = 100.0 * kRatio * kRatio * kRatio;
+	}
+	else if (last < m_words.size())
+	{
+		const double kRatio = (kStretch > 0.0) ? (kWidth - kNatural) / kStretch : kMAX_BADNESS;
+		badness = std::min(100.0 * kRatio * kRatio * kRatio, kMAX_BADNESS);
+	}
+
+	return (kLINE_PENALTY + badness) * (kLINE_PENALTY + badness);
+}
+
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * @file   TeXCompositor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Knuth-Plass (total fit) line breaking.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_TEXCOMPOSITOR_HPP
+#define LEXI_TEXCOMPOSITOR_HPP
+
+namespace Lexi
+{
+	class TeXCompositor;
+	LEXI_DECLARE_PTR(TeXCompositor);
+
+	/**
+	 * Knuth-Plass line breaking: the breaks minimizing the demerits of the
+	 * whole paragraph.
+	 *
+	 * Spaces may stretch by half & shrink by a third of their width. A line
+	 * has demerits (kLINE_PENALTY + badness)^2, badness growing with the cube
+	 * of how far its spaces are stretched or shrunk; the last line is free to
+	 * end short. Dynamic programming over the words, trying only lines that
+	 * fit, takes time proportional to the words times the words per line.
+	 * Hyphenation is not attempted.
+	 */
+	class TeXCompositor final : public ICompositor
+	{
+	public:
+		static constexpr std::string_view kNAME = "tex";
+		static constexpr double kLINE_PENALTY = 10.0;
+		static constexpr double kMAX_BADNESS = 10'000.0;
+		//! Demerits of a word too wide for any line, on a line of its own.
+		static constexpr double kOVERFULL_DEMERITS = 1e12;
+	private:
+		// Scratch space, reused between paragraphs:
+		std::vector<Word> m_words;
+		std::vector<std::int64_t> m_wordWidths; //!< Prefix sums of the word widths
+		std::vector<std::int64_t> m_spaceWidths; //!< Prefix sums of the space widths
+		std::vector<double> m_demerits; //!< Least total demerits of breaking before each word
+		std::vector<std::uint32_t> m_previousBreaks; //!< Break before the line ending there
+	public:
+		TeXCompositor(void);
+
+		void VCompose(std::span<const IGlyph *const> glyphs, std::int32_t lineWidth, LineStarts &lineStarts) override;
+		UniqueICompositorPtr VClone(void) const override;
+		std::string_view VGetName(void) const noexcept override;
+	private:
+		//! Compute the demerits of words [first, last) set as one line, negative if they can't be.
+		double GetLineDemerits(std::size_t first, std::size_t last, std::int32_t lineWidth) const noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_TEXCOMPOSITOR_HPP */
@@ -0,0 +1,463 @@
+/*******************************************************************************
+ * @file   PieceTable.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Piece table text buffer.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "PieceTable.hpp"
+
+using Lexi::PieceTable;
+
+PieceTable::PieceTable(void)
+	: m_pOriginalFile{},
+	  m_originalText{},
+	  m_add{},
+	  m_pRoot{},
+	  m_undoStack{},
+	  m_redoStack{}
+{
+}
+
+PieceTable::PieceTable(const std::filesystem::path &kPath)
+	: PieceTable()
+{
+	m_pOriginalFile = std::make_unique<MemoryMappedFile>(kPath);
+	if (m_pOriginalFile->GetSize() > 0)
+	{
+		m_pRoot = MakeNode(nullptr, Piece{ Buffer::kOriginal, 0, m_pOriginalFile->GetSize() }, nullptr);
+	}
+}
+
+PieceTable PieceTable::FromText(std::string text)
+{
+	PieceTable table;
+	table.m_originalText = std::move(text);
+	if (!table.m_originalText.empty())
+	{
+		table.m_pRoot = MakeNode(nullptr, Piece{ Buffer::kOriginal, 0, table.m_originalText.size() }, nullptr);
+	}
+
+	return table;
+}
+
+void PieceTable::Insert(std::size_t offset, std::string_view text)
+{
+	LEXI_THROW_IF(offset > GetSize(), "Piece table insert position is out of range!");
+	if (text.empty())
+	{
+		return;
+	}
+
+	PushRevision();
+	const Piece kPiece{ Buffer::kAdd, m_add.size(), text.size() };
+	m_add.append(text);
+
+	auto [pLeft, pRight] = Split(m_pRoot, offset);
+	if (pLeft)
+	{
+		// Typing appends to the add buffer right after the previous insert, grow that piece instead.
+		auto [pRest, last] = SplitLast(pLeft);
+		if (last.buffer == Buffer::kAdd && last.start + last.length == kPiece.start)
+		{
+			last.length += kPiece.length;
+			m_pRoot = Join(pRest, last, pRight);
+			return;
+		}
+	}
+
+	m_pRoot = Join(pLeft, kPiece, pRight);
+}
+
+void PieceTable::Erase(std::size_t offset, std::size_t length)
+{
+	LEXI_THROW_IF(offset > GetSize() || length > GetSize() - offset, "Piece table erase range is out of bounds!");
+	if (length == 0)
+	{
+		return;
+	}
+
+	PushRevision();
+	auto [pLeft, pRest] = Split(m_pRoot, offset);
+	m_pRoot = Join(pLeft, Split(pRest, length).second);
+}
+
+bool PieceTable::Undo(void)
+{
+	if (m_undoStack.empty())
+	{
+		return false;
+	}
+
+	m_redoStack.push_back(std::move(m_pRoot));
+	m_pRoot = std::move(m_undoStack.back());
+	m_undoStack.pop_back();
+	return true;
+}
+
+bool PieceTable::Redo(void)
+{
+	if (m_redoStack.empty())
+	{
+		return false;
+	}
+
+	m_undoStack.push_back(std::move(m_pRoot));
+	m_pRoot = std::move(m_redoStack.back());
+	m_redoStack.pop_back();
+	return true;
+}
+
+std::string PieceTable::GetText(std::size_t offset, std::size_t length) const
+{
+	std::string text;
+	text.reserve(length);
+	ForEachChunk(offset, length, [&text](std::string_view chunk) { text.append(chunk); });
+	return text;
+}
+
+std::string PieceTable::GetText(void) const
+{
+	return GetText(0, GetSize());
+}
+
+char PieceTable::GetChar(std::size_t offset) const
+{
+	LEXI_THROW_IF(offset >= GetSize(), "Piece table offset is out of range!");
+	return *GetIterator(offset);
+}
+
+void PieceTable::Accept(IVisitor &visitor) const
+{
+	ForEachChunk([&visitor](std::string_view chunk) { visitor.VVisitText(chunk); });
+}
+
+PieceTable::Iterator PieceTable::begin(void) const
+{
+	return GetIterator(0);
+}
+
+PieceTable::Iterator PieceTable::end(void) const
+{
+	return GetIterator(GetSize());
+}
+
+PieceTable::Iterator PieceTable::GetIterator(std::size_t offset) const
+{
+	LEXI_THROW_IF(offset > GetSize(), "Piece table offset is out of range!");
+	return Iterator(*this, offset);
+}
+
+std::size_t PieceTable::GetSize(void) const noexcept
+{
+	return GetLength(m_pRoot);
+}
+
+bool PieceTable::IsEmpty(void) const noexcept
+{
+	return !m_pRoot;
+}
+
+std::size_t PieceTable::GetNumPieces(void) const noexcept
+{
+	return m_pRoot ? m_pRoot->numPieces : 0;
+}
+
+bool PieceTable::CanUndo(void) const noexcept
+{
+	return !m_undoStack.empty();
+}
+
+bool PieceTable::CanRedo(void) const noexcept
+{
+	return !m_redoStack.empty();
+}
+
+std::size_t PieceTable::GetMemoryUsage(void) const noexcept
+{
+	// Nodes are allocated by make_shared, so each one carries its control block.
+	constexpr std::size_t kNODE_SIZE = sizeof(Node) + 2 * sizeof(long);
+	return sizeof(*this) + GetNumPieces() * kNODE_SIZE + m_originalText.capacity() + m_add.capacity() +
+		   (m_undoStack.capacity() + m_redoStack.capacity()) * sizeof(NodePtr);
+}
+
+std::string_view PieceTable::GetOriginal(void) const noexcept
+{
+	return m_pOriginalFile ? m_pOriginalFile->GetText() : std::string_view(m_originalText);
+}
+
+std::string_view PieceTable::GetPieceText(const Piece &kPiece) const noexcept
+{
+	const std::string_view kBuffer = kPiece.buffer == Buffer::kOriginal ? GetOriginal() : std::string_view(m_add);
+	return kBuffer.substr(kPiece.start, kPiece.length);
+}
+
+void PieceTable::PushRevision(void)
+{
+	m_undoStack.push_back(m_pRoot);
+	m_redoStack.clear();
+}
+
+std::size_t PieceTable::GetLength(const NodePtr &kpNode) noexcept
+{
+	return kpNode ? kpNode->length : 0;
+}
+
+std::uint8_t PieceTable::GetHeight(const NodePtr &kpNode) noexcept
+{
+	return kpNode ? kpNode->height : 0;
+}
+
+PieceTable::NodePtr PieceTable::MakeNode(NodePtr pLeft, const Piece &kPiece, NodePtr pRight)
+{
+	const std::size_t kLength = GetLength(pLeft) + kPiece.length + GetLength(pRight);
+	const std::size_t kNumPieces = (pLeft ? pLeft->numPieces : 0) + 1 + (pRight ? pRight->numPieces : 0);
+	const auto kHeight = static_cast<std::uint8_t>(std::max(GetHeight(pLeft), GetHeight(pRight)) + 1);
+	return std::make_shared<const Node>(Node{ kPiece, std::move(pLeft), std::move(pRight), kLength, kNumPieces, kHeight });
+}
+
+PieceTable::NodePtr PieceTable::RotateLeft(const NodePtr &kpNode)
+{
+	const Node &kRight = *kpNode->pRight;
+	return MakeNode(MakeNode(kpNode->pLeft, kpNode->piece, kRight.pLeft), kRight.piece, kRight.pRight);
+}
+
+PieceTable::NodePtr PieceTable::RotateRight(const NodePtr &kpNode)
+{
+	const Node &kLeft = *kpNode->pLeft;
+	return MakeNode(kLeft.pLeft, kLeft.piece, MakeNode(kLeft.pRight, kpNode->piece, kpNode->pRight));
+}
+
+PieceTable::NodePtr PieceTable::Join(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight)
+{
+	if (GetHeight(kpLeft) > GetHeight(kpRight) + 1)
+	{
+		return JoinRight(kpLeft, kPiece, kpRight);
+	}
+	else if (GetHeight(kpRight) > GetHeight(kpLeft) + 1)
+	{
+		return JoinLeft(kpLeft, kPiece, kpRight);
+	}
+
+	return MakeNode(kpLeft, kPiece, kpRight);
+}
+
+PieceTable::NodePtr PieceTable::JoinRight(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight)
+{
+	// Walk down the right spine of the taller left tree until the heights meet.
+	const Node &kLeft = *kpLeft;
+	if (GetHeight(kLeft.pRight) <= GetHeight(kpRight) + 1)
+	{
+		const NodePtr kpJoined = MakeNode(kLeft.pRight, kPiece, kpRight);
+		if (GetHeight(kpJoined) <= GetHeight(kLeft.pLeft) + 1)
+		{
+			return MakeNode(kLeft.pLeft, kLeft.piece, kpJoined);
+		}
+
+		return RotateLeft(MakeNode(kLeft.pLeft, kLeft.piece, RotateRight(kpJoined)));
+	}
+
+	const NodePtr kpJoined = JoinRight(kLeft.pRight, kPiece, kpRight);
+	const NodePtr kpNode = MakeNode(kLeft.pLeft, kLeft.piece, kpJoined);
+	return GetHeight(kpJoined) <= GetHeight(kLeft.pLeft) + 1 ? kpNode : RotateLeft(kpNode);
+}
+
+PieceTable::NodePtr PieceTable::JoinLeft(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight)
+{
+	// Mirror of JoinRight, down the left spine of the taller right tree.
+	const Node &kRight = *kpRight;
+	if (GetHeight(kRight.pLeft) <= GetHeight(kpLeft) + 1)
+	{
+		const NodePtr kpJoined = MakeNode(kpLeft, kPiece, kRight.pLeft);
+		if (GetHeight(kpJoined) <= GetHeight(kRight.pRight) + 1)
+		{
+			return MakeNode(kpJoined, kRight.piece, kRight.pRight);
+		}
+
+		return RotateRight(MakeNode(RotateLeft(kpJoined), kRight.piece, kRight.pRight));
+	}
+
+	const NodePtr kpJoined = JoinLeft(kpLeft, kPiece, kRight.pLeft);
+	const NodePtr kpNode = MakeNode(kpJoined, kRight.piece, kRight.pRight);
+	return GetHeight(kpJoined) <= GetHeight(kRight.pRight) + 1 ? kpNode : RotateRight(kpNode);
+}
+
+PieceTable::NodePtr PieceTable::Join(const NodePtr &kpLeft, const NodePtr &kpRight)
+{
+	if (!kpLeft)
+	{
+		return kpRight;
+	}
+	else if (!kpRight)
+	{
+		return kpLeft;
+	}
+
+	const auto [kpRest, kLast] = SplitLast(kpLeft);
+	return Join(kpRest, kLast, kpRight);
+}
+
+std::pair<PieceTable::NodePtr, PieceTable::NodePtr> PieceTable::Split(const NodePtr &kpNode, std::size_t offset)
+{
+	if (!kpNode)
+	{
+		return {};
+	}
+
+	const std::size_t kLeftLength = GetLength(kpNode->pLeft);
+	const std::size_t kPieceEnd = kLeftLength + kpNode->piece.length;
+	if (offset < kLeftLength)
+	{
+		auto [pLeft, pRight] = Split(kpNode->pLeft, offset);
+		return { std::move(pLeft), Join(pRight, kpNode->piece, kpNode->pRight) };
+	}
+	else if (offset > kPieceEnd)
+	{
+		auto [pLeft, pRight] = Split(kpNode->pRight, offset - kPieceEnd);
+		return { Join(kpNode->pLeft, kpNode->piece, pLeft), std::move(pRight) };
+	}
+	else if (offset == kLeftLength)
+	{
+		return { kpNode->pLeft, Join(nullptr, kpNode->piece, kpNode->pRight) };
+	}
+	else if (offset == kPieceEnd)
+	{
+		return { Join(kpNode->pLeft, kpNode->piece, nullptr), kpNode->pRight };
+	}
+
+	// The offset falls inside this node's piece, which becomes two.
+	const Piece &kPiece = kpNode->piece;
+	const std::size_t kHeadLength = offset - kLeftLength;
+	const Piece kHead{ kPiece.buffer, kPiece.start, kHeadLength };
+	const Piece kTail{ kPiece.buffer, kPiece.start + kHeadLength, kPiece.length - kHeadLength };
+	return { Join(kpNode->pLeft, kHead, nullptr), Join(nullptr, kTail, kpNode->pRight) };
+}
+
+std::pair<PieceTable::NodePtr, PieceTable::Piece> PieceTable::SplitLast(const NodePtr &kpNode)
+{
+	if (!kpNode->pRight)
+	{
+		return { kpNode->pLeft, kpNode->piece };
+	}
+
+	auto [pRest, last] = SplitLast(kpNode->pRight);
+	return { Join(kpNode->pLeft, kpNode->piece, pRest), last };
+}
+
+PieceTable::Iterator::Iterator(void)
+	: m_pTable(nullptr),
+	  m_ancestors{},
+	  m_pNode(nullptr),
+	  m_chunk{},
+	  m_index(0),
+	  m_offset(0)
+{
+}
+
+PieceTable::Iterator::Iterator(const PieceTable &kTable, std::size_t offset)
+	: m_pTable(&kTable),
+	  m_ancestors{},
+	  m_pNode(nullptr),
+	  m_chunk{},
+	  m_index(0),
+	  m_offset(offset)
+{
+	const Node *pNode = kTable.m_pRoot.get();
+	while (pNode)
+	{
+		const std::size_t kLeftLength = GetLength(pNode->pLeft);
+		if (offset < kLeftLength)
+		{
+			m_ancestors.push_back(pNode);
+			pNode = pNode->pLeft.get();
+		}
+		else if (offset < kLeftLength + pNode->piece.length)
+		{
+			m_pNode = pNode;
+			m_chunk = kTable.GetPieceText(pNode->piece);
+			m_index = offset - kLeftLength;
+			break;
+		}
+		else
+		{
+			offset -= kLeftLength + pNode->piece.length;
+			pNode = pNode->pRight.get();
+		}
+	}
+}
+
+PieceTable::Iterator PieceTable::Iterator::operator++(int)
+{
+	Iterator previous = *this;
+	++*this;
+	return previous;
+}
+
+bool PieceTable::Iterator::operator==(const Iterator &kOther) const noexcept
+{
+	return m_offset == kOther.m_offset;
+}
+
+std::string_view PieceTable::Iterator::GetChunk(void) const noexcept
+{
+	return m_chunk.substr(m_index);
+}
+
+void PieceTable::Iterator::NextChunk(void)
+{
+	if (!m_pNode)
+	{
+		return;
+	}
+
+	m_offset += m_chunk.size() - m_index;
+	// In-order successor: leftmost node of the right subtree, else the nearest pending ancestor.
+	const Node *pNext = m_pNode->pRight.get();
+	if (pNext)
+	{
+		while (pNext->pLeft)
+		{
+			m_ancestors.push_back(pNext);
+			pNext = pNext->pLeft.get();
+		}
+	}
+	else if (!m_ancestors.empty())
+	{
+		pNext = m_ancestors.back();
+		m_ancestors.pop_back();
+	}
+
+	m_pNode = pNext;
+	m_chunk = pNext ? m_pTable->GetPieceText(pNext->piece) : std::string_view{};
+	m_index = 0;
+}
+
+std::size_t PieceTable::Iterator::GetOffset(void) const noexcept
+{
+	return m_offset;
+}
+
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * @file   PieceTable.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Piece table text buffer.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_PIECETABLE_HPP
+#define LEXI_PIECETABLE_HPP
+
+namespace Lexi
+{
+	class PieceTable;
+	LEXI_DECLARE_PTR(PieceTable);
+
+	/**
+	 * Document text stored as a piece table.
+	 *
+	 * The text is a sequence of pieces, each referencing a span of either
+	 * the original buffer (the opened file, memory-mapped & never copied) or
+	 * the add buffer (everything typed since, only ever appended to). Edits
+	 * never move text: they split, drop & add pieces.
+	 *
+	 * Pieces live in an AVL tree keyed by text offset, built from immutable
+	 * nodes that later revisions share (only the O(log n) nodes on the edited
+	 * path are copied). Inserts & erases are O(log n), and undo/redo just
+	 * swap tree roots.
+	 */
+	class PieceTable
+	{
+	public:
+		enum struct Buffer : std::uint8_t
+		{
+			kOriginal,
+			kAdd
+		};
+		//! Span of one of the two buffers.
+		struct Piece
+		{
+			Buffer buffer;
+			std::size_t start;
+			std::size_t length;
+		};
+		class Iterator;
+	private:
+		struct Node;
+		using NodePtr = std::shared_ptr<const Node>;
+		//! Immutable tree node, shared between revisions.
+		struct Node
+		{
+			Piece piece;
+			NodePtr pLeft;
+			NodePtr pRight;
+			std::size_t length; //!< Text length of the whole subtree
+			std::size_t numPieces; //!< Number of pieces in the subtree
+			std::uint8_t height;
+		};
+
+		UniqueMemoryMappedFilePtr m_pOriginalFile; //!< Original buffer when opened from a file
+		std::string m_originalText; //!< Original buffer otherwise
+		std::string m_add; //!< Add buffer (append-only, so old revisions stay valid)
+		NodePtr m_pRoot; //!< Current revision
+		std::vector<NodePtr> m_undoStack; //!< Earlier revisions, most recent last
+		std::vector<NodePtr> m_redoStack; //!< Undone revisions, most recent last
+	public:
+		PieceTable(void);
+		//! Open a file as the original buffer (mapped, not copied).
+		explicit PieceTable(const std::filesystem::path &kPath);
+		//! Start from text held in memory.
+		static PieceTable FromText(std::string text);
+
+		//! Insert text before offset (an offset of GetSize() appends).
+		void Insert(std::size_t offset, std::string_view text);
+		//! Erase length characters starting at offset.
+		void Erase(std::size_t offset, std::size_t length);
+		//! Return to the revision before the last edit, returns false if there is none.
+		bool Undo(void);
+		//! Reapply the last undone edit, returns false if there is none.
+		bool Redo(void);
+		//! Copy length characters starting at offset.
+		std::string GetText(std::size_t offset, std::size_t length) const;
+		std::string GetText(void) const;
+		char GetChar(std::size_t offset) const;
+		/**
+		 * Invoke func(std::string_view) for the pieces of a range in order.
+		 *
+		 * The views are invalidated by the next Insert(): appending to the add
+		 * buffer may move it. Copy what has to outlive an edit.
+		 */
+		template <typename Func>
+		void ForEachChunk(std::size_t offset, std::size_t length, Func &&func) const;
+		template <typename Func>
+		void ForEachChunk(Func &&func) const;
+		//! Pass the text to a visitor, one VVisitText call per piece.
+		void Accept(IVisitor &visitor) const;
+		//! Pass the text to a visitor without virtual dispatch.
+		template <StaticVisitorType Visitor>
+		void Accept(Visitor &visitor) const;
+		//! Iterators are invalidated by edits, undo & redo.
+		Iterator begin(void) const;
+		Iterator end(void) const;
+		Iterator GetIterator(std::size_t offset) const;
+		// Accessors:
+		std::size_t GetSize(void) const noexcept;
+		bool IsEmpty(void) const noexcept;
+		std::size_t GetNumPieces(void) const noexcept;
+		bool CanUndo(void) const noexcept;
+		bool CanRedo(void) const noexcept;
+		//! Retrieve the memory used by the current revision (mapped files excluded).
+		std::size_t GetMemoryUsage(void) const noexcept;
+	private:
+		std::string_view GetOriginal(void) const noexcept;
+		std::string_view GetPieceText(const Piece &kPiece) const noexcept;
+		void PushRevision(void);
+		template <typename Func>
+		void ForEachChunk(const Node *pNode, std::size_t offset, std::size_t length, Func &func) const;
+
+		static std::size_t GetLength(const NodePtr &kpNode) noexcept;
+		static std::uint8_t GetHeight(const NodePtr &kpNode) noexcept;
+		static NodePtr MakeNode(NodePtr pLeft, const Piece &kPiece, NodePtr pRight);
+		static NodePtr RotateLeft(const NodePtr &kpNode);
+		static NodePtr RotateRight(const NodePtr &kpNode);
+		//! Join two trees with a piece between them, rebalancing on the way (all of left precedes right).
+		static NodePtr Join(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight);
+		static NodePtr JoinRight(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight);
+		static NodePtr JoinLeft(const NodePtr &kpLeft, const Piece &kPiece, const NodePtr &kpRight);
+		static NodePtr Join(const NodePtr &kpLeft, const NodePtr &kpRight);
+		//! Split a tree into the text before offset & the text from offset on.
+		static std::pair<NodePtr, NodePtr> Split(const NodePtr &kpNode, std::size_t offset);
+		//! Split off the last piece of a (non-empty) tree.
+		static std::pair<NodePtr, Piece> SplitLast(const NodePtr &kpNode);
+	};
+
+	//! Forward iterator over the characters of a PieceTable revision.
+	class PieceTable::Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = char;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const char *;
+		using reference = const char &;
+	private:
+		const PieceTable *m_pTable;
+		std::vector<const Node *> m_ancestors; //!< Nodes whose piece follows the current one, nearest last
+		const Node *m_pNode; //!< Node of the current piece (nullptr at the end)
+		std::string_view m_chunk; //!< Text of the current piece
+		std::size_t m_index; //!< Position in the current piece
+		std::size_t m_offset; //!< Position in the whole text
+	public:
+		Iterator(void);
+		Iterator(const PieceTable &kTable, std::size_t offset);
+
+		reference operator*(void) const noexcept;
+		Iterator &operator++(void);
+		Iterator operator++(int);
+		//! Iterators compare by position, only compare iterators of the same revision.
+		bool operator==(const Iterator &kOther) const noexcept;
+		//! Retrieve the rest of the current piece, to walk the text a piece at a time.
+		std::string_view GetChunk(void) const noexcept;
+		//! Skip to the start of the next piece.
+		void NextChunk(void);
+		std::size_t GetOffset(void) const noexcept;
+	};
+
+	inline PieceTable::Iterator::reference PieceTable::Iterator::operator*(void) const noexcept
+	{
+		return m_chunk[m_index];
+	}
+
+	inline PieceTable::Iterator &PieceTable::Iterator::operator++(void)
+	{
+		++m_offset;
+		if (++m_index == m_chunk.size())
+		{
+			NextChunk();
+		}
+
+		return *this;
+	}
+
+	template <StaticVisitorType Visitor>
+	inline void PieceTable::Accept(Visitor &visitor) const
+	{
+		if constexpr ((Visitor::kGLYPH_KINDS & kGLYPH_KIND_MASK<GlyphKind::kCharacter>) != 0)
+		{
+			ForEachChunk([&visitor](std::string_view chunk) { visitor.VisitText(chunk); });
+		}
+	}
+
+	template <typename Func>
+	inline void PieceTable::ForEachChunk(std::size_t offset, std::size_t length, Func &&func) const
+	{
+		LEXI_THROW_IF(offset > GetSize() || length > GetSize() - offset, "Piece table range is out of bounds!");
+		if (length > 0)
+		{
+			ForEachChunk(m_pRoot.get(), offset, length, func);
+		}
+	}
+
+	template <typename Func>
+	inline void PieceTable::ForEachChunk(Func &&func) const
+	{
+		ForEachChunk(0, GetSize(), std::forward<Func>(func));
+	}
+
+	template <typename Func>
+	inline void PieceTable::ForEachChunk(const Node *pNode, std::size_t offset, std::size_t length, Func &func) const
+	{
+		// Only subtrees overlapping [offset, offset + length) are entered.
+		const std::size_t kLeftLength = pNode->pLeft ? pNode->pLeft->length : 0;
+		if (offset < kLeftLength)
+		{
+			ForEachChunk(pNode->pLeft.get(), offset, std::min(length, kLeftLength - offset), func);
+		}
+
+		const std::size_t kPieceEnd = kLeftLength + pNode->piece.length;
+		const std::size_t kEnd = offset + length;
+		if (offset < kPieceEnd && kEnd > kLeftLength)
+		{
+			const std::size_t kStart = std::max(offset, kLeftLength) - kLeftLength;
+			func(GetPieceText(pNode->piece).substr(kStart, std::min(kEnd, kPieceEnd) - kLeftLength - kStart));
+		}
+
+		if (kEnd > kPieceEnd)
+		{
+			const std::size_t kRightOffset = std::max(offset, kPieceEnd) - kPieceEnd;
+			ForEachChunk(pNode->pRight.get(), kRightOffset, kEnd - std::max(offset, kPieceEnd), func);
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_PIECETABLE_HPP */
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * @file   Character.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Flyweight character glyph.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Character.hpp"
+
+using Lexi::Character;
+
+Character::Character(char32_t codePoint, StyleId style, std::uint16_t width, std::uint16_t height) noexcept
+	: IGlyph(GlyphKind::kCharacter),
+	  m_codePoint(codePoint),
+	  m_style(style),
+	  m_width(width),
+	  m_height(height)
+{
+}
+
+void Character::VAccept(IVisitor &visitor) const
+{
+	char bytes[Unicode::kMAX_SEQUENCE_LENGTH];
+	const std::size_t kLength = Encode(bytes);
+	for (std::size_t index = 0; index < kLength; ++index)
+	{
+		visitor.VVisitCharacter(bytes[index]);
+	}
+}
+
+std::int32_t Character::VGetWidth(void) const noexcept
+{
+	return m_width;
+}
+
+std::int32_t Character::VGetHeight(void) const noexcept
+{
+	return m_height;
+}
+
+std::size_t Character::Encode(char *pOutput) const noexcept
+{
+	return Unicode::Encode(m_codePoint, pOutput);
+}
+
+char32_t Character::GetCodePoint(void) const noexcept
+{
+	return m_codePoint;
+}
+
+Lexi::StyleId Character::GetStyle(void) const noexcept
+{
+	return m_style;
+}
+
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * @file   Character.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Flyweight character glyph.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_CHARACTER_HPP
+#define LEXI_CHARACTER_HPP
+
+namespace Lexi
+{
+	class Character;
+	LEXI_DECLARE_PTR(Character);
+	//! Index of a text style (font & size) registered with a CharacterPool.
+	using StyleId = std::uint16_t;
+
+	/**
+	 * Character glyph, the flyweight of the document structure.
+	 *
+	 * Only intrinsic state is stored: the code point, its style & the
+	 * metrics they imply. Characters are immutable & shared through a
+	 * CharacterPool, so a document holds one object per distinct (code
+	 * point, style) pair no matter how long it is.
+	 */
+	class Character final : public IGlyph
+	{
+	private:
+		char32_t m_codePoint;
+		StyleId m_style;
+		std::uint16_t m_width;
+		std::uint16_t m_height;
+	public:
+		Character(char32_t codePoint, StyleId style, std::uint16_t width, std::uint16_t height) noexcept;
+		Character(const Character &) = delete;
+		Character &operator=(const Character &) = delete;
+		//! Characters are visited as UTF-8, one VVisitCharacter call per byte.
+		void VAccept(IVisitor &visitor) const override;
+		//! Visit without virtual dispatch, as VAccept.
+		template <StaticVisitorType Visitor>
+		void Accept(Visitor &visitor) const;
+		std::int32_t VGetWidth(void) const noexcept override;
+		std::int32_t VGetHeight(void) const noexcept override;
+		//! Write the UTF-8 encoding to pOutput (Unicode::kMAX_SEQUENCE_LENGTH bytes), returns its length.
+		std::size_t Encode(char *pOutput) const noexcept;
+		// Accessors:
+		char32_t GetCodePoint(void) const noexcept;
+		StyleId GetStyle(void) const noexcept;
+	};
+
+	template <StaticVisitorType Visitor>
+	inline void Character::Accept(Visitor &visitor) const
+	{
+		if (m_codePoint < 0x80)
+		{
+			visitor.VisitCharacter(static_cast<char>(m_codePoint));
+			return;
+		}
+
+		char bytes[Unicode::kMAX_SEQUENCE_LENGTH];
+		const std::size_t kLength = Encode(bytes);
+		for (std::size_t index = 0; index < kLength; ++index)
+		{
+			visitor.VisitCharacter(bytes[index]);
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_CHARACTER_HPP */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * @file   CharacterPool.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Interned pool of shared character glyphs.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "CharacterPool.hpp"
+
+using Lexi::CharacterPool;
+
+CharacterPool::CharacterPool(void)
+	: CharacterPool(std::pmr::get_default_resource())
+{
+}
+
+CharacterPool::CharacterPool(std::pmr::memory_resource *pResource)
+	: m_styles{},
+	  m_characters(pResource),
+	  m_asciiCharacters(pResource),
+	  m_characterMap(pResource),
+	  m_numRequests(0)
+{
+}
+
+Lexi::StyleId CharacterPool::AddStyle(TextStyle style)
+{
+	LEXI_THROW_IF(m_styles.size() > std::numeric_limits<StyleId>::max(), "Too many text styles!");
+	m_styles.push_back(std::move(style));
+	m_asciiCharacters.emplace_back();
+	m_asciiCharacters.back().fill(nullptr);
+	return static_cast<StyleId>(m_styles.size() - 1);
+}
+
+const Lexi::TextStyle &CharacterPool::GetStyle(StyleId style) const
+{
+	LEXI_THROW_IF(style >= m_styles.size(), std::format("Unknown text style {}!", style));
+	return m_styles[style];
+}
+
+std::size_t CharacterPool::GetNumStyles(void) const noexcept
+{
+	return m_styles.size();
+}
+
+CharacterPool::Stats CharacterPool::GetStats(void) const noexcept
+{
+	// Map nodes are estimated as the value plus a next pointer & cached hash.
+	const std::size_t kMapBytes = m_characterMap.bucket_count() * sizeof(void *) +
+		m_characterMap.size() * (sizeof(std::pair<std::uint64_t, const Character *>) + 2 * sizeof(void *));
+	return Stats{
+		m_characters.size(),
+		m_numRequests,
+		sizeof(*this) + m_styles.capacity() * sizeof(TextStyle) + m_characters.size() * sizeof(Character) +
+			m_asciiCharacters.capacity() * sizeof(AsciiTable) + kMapBytes
+	};
+}
+
+const Lexi::Character &CharacterPool::Create(char32_t codePoint, StyleId style)
+{
+	const std::uint64_t kKey = GetKey(codePoint, style);
+	if (codePoint >= 0x80)
+	{
+		const auto kIter = m_characterMap.find(kKey);
+		if (kIter != m_characterMap.end())
+		{
+			return *kIter->second;
+		}
+	}
+
+	const TextStyle &kStyle = GetStyle(style);
+	const auto kWidth = static_cast<std::uint16_t>(IsWide(codePoint) ? kStyle.cellWidth * 2 : kStyle.cellWidth);
+	const Character &kCharacter = m_characters.emplace_back(codePoint, style, kWidth, kStyle.lineHeight);
+	if (codePoint < 0x80)
+	{
+		m_asciiCharacters[style][codePoint] = &kCharacter;
+	}
+	else
+	{
+		m_characterMap.emplace(kKey, &kCharacter);
+	}
+
+	return kCharacter;
+}
+
+std::uint64_t CharacterPool::GetKey(char32_t codePoint, StyleId style) noexcept
+{
+	return (std::uint64_t{ style } << 32) | codePoint;
+}
+
+bool CharacterPool::IsWide(char32_t codePoint) noexcept
+{
+	// Main East Asian Wide & Fullwidth blocks, enough for cell based layout.
+	constexpr std::pair<char32_t, char32_t> kWIDE_RANGES[] = {
+		{ 0x1100, 0x115F }, { 0x2E80, 0x303E }, { 0x3041, 0x33FF }, { 0x3400, 0x4DBF }, { 0x4E00, 0x9FFF },
+		{ 0xA000, 0xA4CF }, { 0xAC00, 0xD7A3 }, { 0xF900, 0xFAFF }, { 0xFE30, 0xFE4F }, { 0xFF00, 0xFF60 },
+		{ 0xFFE0, 0xFFE6 }, { 0x1F300, 0x1F64F }, { 0x1F900, 0x1F9FF }, { 0x20000, 0x3FFFD }
+	};
+	return std::ranges::any_of(kWIDE_RANGES, [codePoint](const auto &kRange)
+	{
+		return codePoint >= kRange.first && codePoint <= kRange.second;
+	});
+}
+
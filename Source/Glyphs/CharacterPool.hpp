@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * @file   CharacterPool.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Interned pool of shared character glyphs.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_CHARACTERPOOL_HPP
+#define LEXI_CHARACTERPOOL_HPP
+
+namespace Lexi
+{
+	class CharacterPool;
+	LEXI_DECLARE_PTR(CharacterPool);
+	//! Font & metrics shared by the characters of a style.
+	struct TextStyle
+	{
+		std::string fontName;
+		std::uint16_t cellWidth; //!< Advance of a narrow character in pixels
+		std::uint16_t lineHeight; //!< Height of a character in pixels
+	};
+
+	/**
+	 * Interned pool of Character flyweights (GoF Flyweight factory).
+	 *
+	 * Characters are created on first request & shared by every later one
+	 * with the same (code point, style) pair; they live as long as the pool.
+	 * ASCII characters are found through a direct table per style, other
+	 * code points through a hash map. The characters & their indexes can be
+	 * placed in a document's GlyphArena; such a pool must be destroyed before
+	 * the arena is released. Not thread-safe: a pool belongs to the thread
+	 * editing its documents.
+	 */
+	class CharacterPool
+	{
+	public:
+		//! Memory used by the pool & how often it was asked for characters.
+		struct Stats
+		{
+			std::size_t numCharacters; //!< Distinct characters created
+			std::size_t numRequests; //!< Calls to Get()
+			std::size_t numBytes; //!< Memory used by the pool
+		};
+	private:
+		using AsciiTable = std::array<const Character *, 128>;
+
+		std::vector<TextStyle> m_styles;
+		std::pmr::deque<Character> m_characters; //!< Interned characters (a deque keeps their addresses)
+		std::pmr::vector<AsciiTable> m_asciiCharacters; //!< ASCII characters of each style
+		std::pmr::unordered_map<std::uint64_t, const Character *> m_characterMap; //!< Other characters by GetKey()
+		std::size_t m_numRequests;
+	public:
+		CharacterPool(void);
+		//! Allocate the characters from a memory resource (such as a GlyphArena).
+		explicit CharacterPool(std::pmr::memory_resource *pResource);
+		CharacterPool(const CharacterPool &) = delete;
+		CharacterPool &operator=(const CharacterPool &) = delete;
+
+		//! Register a style, returns the id characters of that style are requested with.
+		StyleId AddStyle(TextStyle style);
+		//! Retrieve the shared character for a code point in a style.
+		const Character &Get(char32_t codePoint, StyleId style);
+		// Accessors:
+		const TextStyle &GetStyle(StyleId style) const;
+		std::size_t GetNumStyles(void) const noexcept;
+		Stats GetStats(void) const noexcept;
+	private:
+		const Character &Create(char32_t codePoint, StyleId style);
+		static std::uint64_t GetKey(char32_t codePoint, StyleId style) noexcept;
+		//! Determine whether or not a code point takes two cells (East Asian wide & emoji).
+		static bool IsWide(char32_t codePoint) noexcept;
+	};
+
+	inline const Character &CharacterPool::Get(char32_t codePoint, StyleId style)
+	{
+		++m_numRequests;
+		if (codePoint < 0x80 && style < m_asciiCharacters.size())
+		{
+			const Character *pCharacter = m_asciiCharacters[style][codePoint];
+			if (pCharacter != nullptr)
+			{
+				return *pCharacter;
+			}
+		}
+
+		return Create(codePoint, style);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_CHARACTERPOOL_HPP */
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * @file   GlyphArena.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Per-document arena for glyph allocation.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "GlyphArena.hpp"
+
+using Lexi::GlyphArena;
+
+GlyphArena::GlyphArena(std::size_t initialChunkSize)
+	: m_chunks{},
+	  m_pCursor(nullptr),
+	  m_pEnd(nullptr),
+	  m_initialChunkSize(std::clamp(initialChunkSize, std::size_t{ 1024 }, kMAX_CHUNK_SIZE)),
+	  m_nextChunkSize(m_initialChunkSize),
+	  m_stats{}
+{
+}
+
+GlyphArena::~GlyphArena(void)
+{
+	Release();
+}
+
+void GlyphArena::Release(void) noexcept
+{
+	m_chunks.clear();
+	m_pCursor = nullptr;
+	m_pEnd = nullptr;
+	m_nextChunkSize = m_initialChunkSize;
+	m_stats = Stats{};
+}
+
+void GlyphArena::Reset(void)
+{
+	if (m_chunks.size() == 1)
+	{
+		m_pCursor = m_chunks.front().get();
+		m_stats = Stats{ 0, 0, 0, static_cast<std::size_t>(m_pEnd - m_pCursor), 1 };
+		return;
+	}
+
+	// Several chunks are merged into one holding as much, so what was allocated since fits it next time.
+	const std::size_t kNumBytesAllocated = m_stats.numBytesAllocated;
+	Release();
+	if (kNumBytesAllocated > 0)
+	{
+		AddChunk(kNumBytesAllocated, alignof(std::max_align_t));
+	}
+}
+
+GlyphArena::Stats GlyphArena::GetStats(void) const noexcept
+{
+	return m_stats;
+}
+
+void *GlyphArena::do_allocate(std::size_t numBytes, std::size_t alignment)
+{
+	void *pMemory = m_pCursor;
+	std::size_t space = static_cast<std::size_t>(m_pEnd - m_pCursor);
+	if (pMemory == nullptr || std::align(alignment, numBytes, pMemory, space) == nullptr)
+	{
+		AddChunk(numBytes, alignment);
+		pMemory = m_pCursor;
+		space = static_cast<std::size_t>(m_pEnd - m_pCursor);
+		std::align(alignment, numBytes, pMemory, space);
+	}
+
+	std::byte *pNext = static_cast<std::byte *>(pMemory) + numBytes;
+	++m_stats.numAllocations;
+	m_stats.numBytesAllocated += static_cast<std::size_t>(pNext - m_pCursor);
+	m_pCursor = pNext;
+	return pMemory;
+}
+
+void GlyphArena::do_deallocate(void *, std::size_t, std::size_t)
+{
+	++m_stats.numDeallocations;
+}
+
+bool GlyphArena::do_is_equal(const std::pmr::memory_resource &kOther) const noexcept
+{
+	return this == &kOther;
+}
+
+void GlyphArena::AddChunk(std::size_t numBytes, std::size_t alignment)
+{
+	// Requests larger than the next chunk get a chunk of their own size, the rest of the current one is abandoned.
+	const std::size_t kChunkSize = std::max(m_nextChunkSize, numBytes + alignment);
+	m_chunks.push_back(std::unique_ptr<std::byte[]>(LEXI_NEW std::byte[kChunkSize]));
+	m_pCursor = m_chunks.back().get();
+	m_pEnd = m_pCursor + kChunkSize;
+	m_nextChunkSize = std::min(m_nextChunkSize * 2, kMAX_CHUNK_SIZE);
+	m_stats.numBytesReserved += kChunkSize;
+	++m_stats.numChunks;
+}
+
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file   GlyphArena.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Per-document arena for glyph allocation.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_GLYPHARENA_HPP
+#define LEXI_GLYPHARENA_HPP
+
+namespace Lexi
+{
+	class GlyphArena;
+	LEXI_DECLARE_PTR(GlyphArena);
+
+	/**
+	 * Memory resource the glyphs of one document are allocated from.
+	 *
+	 * Allocation bumps a pointer through chunks obtained from the heap, which
+	 * double in size up to kMAX_CHUNK_SIZE. Deallocation does nothing: the
+	 * memory of every glyph is reclaimed at once by Release() (or when the
+	 * arena is destroyed), at a cost proportional to the number of chunks
+	 * instead of the number of glyphs. Reset() does the same but keeps one
+	 * chunk as large as what was allocated, so glyphs rebuilt over & over
+	 * reuse the same memory.
+	 *
+	 * Glyphs made by Create() are never destroyed, so they must keep all of
+	 * their memory in the arena (Row does when created here). Not
+	 * thread-safe: an arena belongs to the thread editing its document.
+	 */
+	class GlyphArena final : public std::pmr::memory_resource
+	{
+	public:
+		static constexpr std::size_t kMIN_CHUNK_SIZE = 64 * 1024;
+		static constexpr std::size_t kMAX_CHUNK_SIZE = 4 * 1024 * 1024;
+		//! Allocation statistics since construction or the last Release() or Reset().
+		struct Stats
+		{
+			std::size_t numAllocations; //!< Calls to allocate()
+			std::size_t numDeallocations; //!< Calls to deallocate(), which reclaim nothing
+			std::size_t numBytesAllocated; //!< Bytes handed out, alignment padding included
+			std::size_t numBytesReserved; //!< Bytes obtained from the heap
+			std::size_t numChunks; //!< Heap allocations made for those bytes
+		};
+	private:
+		std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+		std::byte *m_pCursor; //!< Next free byte of the current chunk
+		std::byte *m_pEnd; //!< End of the current chunk
+		std::size_t m_initialChunkSize;
+		std::size_t m_nextChunkSize;
+		Stats m_stats;
+	public:
+		explicit GlyphArena(std::size_t initialChunkSize = kMIN_CHUNK_SIZE);
+		GlyphArena(const GlyphArena &) = delete;
+		GlyphArena &operator=(const GlyphArena &) = delete;
+		~GlyphArena(void) override;
+		/**
+		 * Construct an object in the arena.
+		 *
+		 * Allocator-aware types (such as Row) are given the arena as their
+		 * allocator, so their own storage lands here too.
+		 */
+		template <typename T, typename... Args>
+		T &Create(Args &&...args);
+		//! Construct an array of default constructed objects in the arena, as Create().
+		template <typename T>
+		std::span<T> CreateArray(std::size_t numObjects);
+		//! Free every chunk at once, invalidating everything allocated so far.
+		void Release(void) noexcept;
+		//! Free everything allocated, keeping one chunk large enough for as much again.
+		void Reset(void);
+		// Accessors:
+		Stats GetStats(void) const noexcept;
+	private:
+		void *do_allocate(std::size_t numBytes, std::size_t alignment) override;
+		void do_deallocate(void *pMemory, std::size_t numBytes, std::size_t alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource &kOther) const noexcept override;
+		//! Start a chunk large enough for the request.
+		void AddChunk(std::size_t numBytes, std::size_t alignment);
+	};
+
+	template <typename T, typename... Args>
+	inline T &GlyphArena::Create(Args &&...args)
+	{
+		return *std::pmr::polymorphic_allocator<>(this).new_object<T>(std::forward<Args>(args)...);
+	}
+
+	template <typename T>
+	inline std::span<T> GlyphArena::CreateArray(std::size_t numObjects)
+	{
+		std::pmr::polymorphic_allocator<T> allocator(this);
+		T *pObjects = allocator.allocate(numObjects);
+		for (std::size_t index = 0; index < numObjects; ++index)
+		{
+			allocator.construct(pObjects + index);
+		}
+
+		return { pObjects, numObjects };
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_GLYPHARENA_HPP */
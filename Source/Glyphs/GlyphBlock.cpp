@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * @file   GlyphBlock.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Structure-of-arrays storage for rows of characters.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "GlyphBlock.hpp"
+
+using Lexi::GlyphBlock;
+
+GlyphBlock::GlyphBlock(void)
+	: m_codePoints{},
+	  m_styles{},
+	  m_xs{},
+	  m_text{},
+	  m_rowStarts{ 0 },
+	  m_rowTextStarts{ 0 },
+	  m_rowYs{},
+	  m_rowWidths{},
+	  m_rowHeights{}
+{
+}
+
+void GlyphBlock::AppendRow(std::string_view text, StyleId style, CharacterPool &pool)
+{
+	LEXI_THROW_IF(IsFull(), "Glyph block is full!");
+	const std::int32_t kY = GetHeight();
+	std::int32_t x = 0;
+	std::int32_t height = 0;
+	while (!text.empty())
+	{
+		const Unicode::CodePoint kCodePoint = Unicode::Decode(text);
+		const Character &kCharacter = pool.Get(kCodePoint.value, style);
+		char bytes[Unicode::kMAX_SEQUENCE_LENGTH];
+		m_text.append(bytes, kCharacter.Encode(bytes));
+		m_codePoints.push_back(kCodePoint.value);
+		m_styles.push_back(style);
+		m_xs.push_back(x);
+		x += kCharacter.VGetWidth();
+		height = std::max(height, kCharacter.VGetHeight());
+		text.remove_prefix(kCodePoint.length);
+	}
+
+	if (height == 0)
+	{
+		// Empty rows still take a line.
+		height = pool.GetStyle(style).lineHeight;
+	}
+
+	m_rowStarts.push_back(static_cast<std::uint32_t>(m_codePoints.size()));
+	m_rowTextStarts.push_back(static_cast<std::uint32_t>(m_text.size()));
+	m_rowYs.push_back(kY);
+	m_rowWidths.push_back(x);
+	m_rowHeights.push_back(height);
+}
+
+void GlyphBlock::Reserve(std::size_t numCharacters, std::size_t numBytes)
+{
+	m_codePoints.reserve(numCharacters);
+	m_styles.reserve(numCharacters);
+	m_xs.reserve(numCharacters);
+	m_text.reserve(numBytes);
+}
+
+void GlyphBlock::Clear(void) noexcept
+{
+	m_codePoints.clear();
+	m_styles.clear();
+	m_xs.clear();
+	m_text.clear();
+	m_rowStarts.resize(1);
+	m_rowTextStarts.resize(1);
+	m_rowYs.clear();
+	m_rowWidths.clear();
+	m_rowHeights.clear();
+}
+
+void GlyphBlock::Accept(IVisitor &visitor) const
+{
+	visitor.VVisitBlock(*this);
+}
+
+GlyphBlock::RowView GlyphBlock::GetRow(std::size_t index) const
+{
+	LEXI_THROW_IF(index >= GetNumRows(), "Glyph block row index is out of range!");
+	const std::size_t kStart = m_rowStarts[index];
+	const std::size_t kLength = m_rowStarts[index + 1] - kStart;
+	const std::size_t kTextStart = m_rowTextStarts[index];
+	return RowView{
+		std::span(m_codePoints).subspan(kStart, kLength),
+		std::span(m_styles).subspan(kStart, kLength),
+		std::span(m_xs).subspan(kStart, kLength),
+		std::string_view(m_text).substr(kTextStart, m_rowTextStarts[index + 1] - kTextStart),
+		Point{ 0, m_rowYs[index] },
+		m_rowWidths[index],
+		m_rowHeights[index]
+	};
+}
+
+std::size_t GlyphBlock::GetNumRows(void) const noexcept
+{
+	return m_rowYs.size();
+}
+
+std::size_t GlyphBlock::GetNumCharacters(void) const noexcept
+{
+	return m_codePoints.size();
+}
+
+bool GlyphBlock::IsFull(void) const noexcept
+{
+	return GetNumRows() >= kMAX_ROWS;
+}
+
+std::int32_t GlyphBlock::GetHeight(void) const noexcept
+{
+	return m_rowYs.empty() ? 0 : m_rowYs.back() + m_rowHeights.back();
+}
+
+std::span<const char32_t> GlyphBlock::GetCodePoints(void) const noexcept
+{
+	return m_codePoints;
+}
+
+std::span<const Lexi::StyleId> GlyphBlock::GetStyles(void) const noexcept
+{
+	return m_styles;
+}
+
+std::span<const std::int32_t> GlyphBlock::GetXs(void) const noexcept
+{
+	return m_xs;
+}
+
+std::string_view GlyphBlock::GetText(void) const noexcept
+{
+	return m_text;
+}
+
+std::size_t GlyphBlock::GetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_codePoints.capacity() * sizeof(char32_t) + m_styles.capacity() * sizeof(StyleId) +
+		   m_xs.capacity() * sizeof(std::int32_t) + m_text.capacity() +
+		   (m_rowStarts.capacity() + m_rowTextStarts.capacity()) * sizeof(std::uint32_t) +
+		   (m_rowYs.capacity() + m_rowWidths.capacity() + m_rowHeights.capacity()) * sizeof(std::int32_t);
+}
+
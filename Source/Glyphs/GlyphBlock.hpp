@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * @file   GlyphBlock.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Structure-of-arrays storage for rows of characters.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_GLYPHBLOCK_HPP
+#define LEXI_GLYPHBLOCK_HPP
+
+namespace Lexi
+{
+	class GlyphBlock;
+	LEXI_DECLARE_PTR(GlyphBlock);
+
+	/**
+	 * Block of up to kMAX_ROWS rows of characters, stored as parallel arrays.
+	 *
+	 * Where Row references one Character object per glyph, a block keeps the
+	 * code points, style ids & x positions of all its characters in
+	 * contiguous arrays (plus their UTF-8 text for text visitors), and the
+	 * extent of every row in per-row arrays. A whole block is handed to a
+	 * visitor in a single VVisitBlock() call, so traversal streams through
+	 * memory instead of chasing a pointer & making a virtual call per glyph.
+	 *
+	 * Blocks are built by appending rows & cleared as a whole, their rows
+	 * can't be edited in place. Composition doesn't keep its rows in blocks:
+	 * a block is a snapshot of laid out rows for whole-document traversals,
+	 * built from them & rebuilt after they change.
+	 */
+	class GlyphBlock
+	{
+	public:
+		static constexpr std::size_t kMAX_ROWS = 128;
+		//! Arrays & extent of one row, positions are relative to the block.
+		struct RowView
+		{
+			std::span<const char32_t> codePoints;
+			std::span<const StyleId> styles;
+			std::span<const std::int32_t> xs; //!< Left edge of each character
+			std::string_view text; //!< UTF-8 encoding of the characters
+			Point origin; //!< Top-left corner of the row
+			std::int32_t width;
+			std::int32_t height;
+		};
+	private:
+		// One entry per character:
+		std::vector<char32_t> m_codePoints;
+		std::vector<StyleId> m_styles;
+		std::vector<std::int32_t> m_xs;
+		std::string m_text;
+		// One entry per row, plus an end entry for the starts:
+		std::vector<std::uint32_t> m_rowStarts; //!< Index of the first character
+		std::vector<std::uint32_t> m_rowTextStarts; //!< Offset of the first character in m_text
+		std::vector<std::int32_t> m_rowYs;
+		std::vector<std::int32_t> m_rowWidths;
+		std::vector<std::int32_t> m_rowHeights;
+	public:
+		GlyphBlock(void);
+
+		/**
+		 * Lay out a row of UTF-8 text below the others.
+		 *
+		 * Character metrics come from the pool's flyweights; invalid UTF-8 is
+		 * stored as U+FFFD. Throws if the block is full.
+		 */
+		void AppendRow(std::string_view text, StyleId style, CharacterPool &pool);
+		//! Reserve space for a number of characters (& their UTF-8 bytes).
+		void Reserve(std::size_t numCharacters, std::size_t numBytes);
+		void Clear(void) noexcept;
+		//! Pass the whole block to a visitor (see IVisitor::VVisitBlock).
+		void Accept(IVisitor &visitor) const;
+		//! Pass the whole block to a visitor without virtual dispatch, one needing only rows gets VisitRow() per row.
+		template <StaticVisitorType Visitor>
+		void Accept(Visitor &visitor) const;
+		RowView GetRow(std::size_t index) const;
+		// Accessors:
+		std::size_t GetNumRows(void) const noexcept;
+		std::size_t GetNumCharacters(void) const noexcept;
+		bool IsFull(void) const noexcept;
+		std::int32_t GetHeight(void) const noexcept;
+		std::span<const char32_t> GetCodePoints(void) const noexcept;
+		std::span<const StyleId> GetStyles(void) const noexcept;
+		std::span<const std::int32_t> GetXs(void) const noexcept;
+		std::string_view GetText(void) const noexcept;
+		//! Retrieve the memory used by the block.
+		std::size_t GetMemoryUsage(void) const noexcept;
+	};
+
+	template <StaticVisitorType Visitor>
+	inline void GlyphBlock::Accept(Visitor &visitor) const
+	{
+		if constexpr ((Visitor::kGLYPH_KINDS & kGLYPH_KIND_MASK<GlyphKind::kCharacter>) != 0)
+		{
+			visitor.VisitBlock(*this);
+		}
+		else if constexpr ((Visitor::kGLYPH_KINDS & kGLYPH_KIND_MASK<GlyphKind::kRow>) != 0)
+		{
+			// Rows only, the characters are skipped.
+			for (std::size_t index = 0; index < GetNumRows(); ++index)
+			{
+				visitor.VisitRow();
+			}
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_GLYPHBLOCK_HPP */
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * @file   IGlyph.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Interface for elements of the document structure.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_IGLYPH_HPP
+#define LEXI_IGLYPH_HPP
+
+namespace Lexi
+{
+	class IGlyph;
+	LEXI_DECLARE_PTR(IGlyph);
+	//! Concrete glyph types known to static traversals (see StaticVisitor).
+	enum struct GlyphKind : std::uint8_t
+	{
+		kCharacter,
+		kRow,
+		kImage,
+		kOther //!< Any other glyph, visited through VAccept()
+	};
+	//! Set of glyph kinds, one bit per GlyphKind.
+	using GlyphKindMask = std::uint8_t;
+	template <GlyphKind... Kinds>
+	inline constexpr GlyphKindMask kGLYPH_KIND_MASK = static_cast<GlyphKindMask>((0u | ... | (1u << static_cast<unsigned>(Kinds))));
+	inline constexpr GlyphKindMask kALL_GLYPH_KINDS =
+		kGLYPH_KIND_MASK<GlyphKind::kCharacter, GlyphKind::kRow, GlyphKind::kImage, GlyphKind::kOther>;
+
+	/**
+	 * Interface for the elements of the document structure.
+	 *
+	 * Glyphs don't store where they are drawn: position is extrinsic state
+	 * computed by the composite containing them (see Row), so a single glyph
+	 * object can appear any number of times (see Character).
+	 *
+	 * Every glyph also carries its kind, so static traversals can dispatch
+	 * on it without a virtual call.
+	 */
+	class IGlyph
+	{
+	private:
+		GlyphKind m_kind;
+	protected:
+		explicit IGlyph(GlyphKind kind = GlyphKind::kOther) noexcept;
+	public:
+		virtual ~IGlyph(void) = default;
+		//! Pass the glyph (& its children) to a visitor.
+		virtual void VAccept(IVisitor &visitor) const = 0;
+		//! Retrieve the horizontal space taken in pixels.
+		virtual std::int32_t VGetWidth(void) const noexcept = 0;
+		//! Retrieve the vertical space taken in pixels.
+		virtual std::int32_t VGetHeight(void) const noexcept = 0;
+		// Accessors:
+		GlyphKind GetKind(void) const noexcept;
+	};
+
+	inline IGlyph::IGlyph(GlyphKind kind) noexcept
+		: m_kind(kind)
+	{
+	}
+
+	inline GlyphKind IGlyph::GetKind(void) const noexcept
+	{
+		return m_kind;
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_IGLYPH_HPP */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * @file   Row.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Row of glyphs (composite).
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Row.hpp"
+
+using Lexi::Row;
+
+Row::Row(void)
+	: Row(allocator_type{})
+{
+}
+
+Row::Row(const allocator_type &kAllocator)
+	: IGlyph(GlyphKind::kRow),
+	  m_children(kAllocator),
+	  m_width(0),
+	  m_height(0)
+{
+}
+
+void Row::Append(const IGlyph &kGlyph)
+{
+	Insert(m_children.size(), kGlyph);
+}
+
+void Row::Insert(std::size_t index, const IGlyph &kGlyph)
+{
+	LEXI_THROW_IF(index > m_children.size(), "Row insert position is out of range!");
+	m_children.insert(m_children.begin() + static_cast<std::ptrdiff_t>(index), &kGlyph);
+	m_width += kGlyph.VGetWidth();
+	m_height = std::max(m_height, kGlyph.VGetHeight());
+}
+
+void Row::Remove(std::size_t index)
+{
+	LEXI_THROW_IF(index >= m_children.size(), "Row remove position is out of range!");
+	const IGlyph *pGlyph = m_children[index];
+	m_children.erase(m_children.begin() + static_cast<std::ptrdiff_t>(index));
+	m_width -= pGlyph->VGetWidth();
+	if (pGlyph->VGetHeight() == m_height)
+	{
+		UpdateHeight();
+	}
+}
+
+void Row::Reserve(std::size_t numChildren)
+{
+	m_children.reserve(numChildren);
+}
+
+void Row::VAccept(IVisitor &visitor) const
+{
+	for (const IGlyph *pChild : m_children)
+	{
+		pChild->VAccept(visitor);
+	}
+
+	visitor.VVisitRow();
+}
+
+std::int32_t Row::VGetWidth(void) const noexcept
+{
+	return m_width;
+}
+
+std::int32_t Row::VGetHeight(void) const noexcept
+{
+	return m_height;
+}
+
+Lexi::Point Row::GetChildPosition(std::size_t index) const
+{
+	LEXI_THROW_IF(index >= m_children.size(), "Row child index is out of range!");
+	std::int32_t x = 0;
+	for (const IGlyph *pChild : std::span(m_children).first(index))
+	{
+		x += pChild->VGetWidth();
+	}
+
+	return Point{ x, 0 };
+}
+
+Row::allocator_type Row::get_allocator(void) const noexcept
+{
+	return m_children.get_allocator();
+}
+
+const Lexi::IGlyph &Row::GetChild(std::size_t index) const
+{
+	LEXI_THROW_IF(index >= m_children.size(), "Row child index is out of range!");
+	return *m_children[index];
+}
+
+std::size_t Row::GetNumChildren(void) const noexcept
+{
+	return m_children.size();
+}
+
+std::size_t Row::GetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_children.capacity() * sizeof(const IGlyph *);
+}
+
+void Row::UpdateHeight(void) noexcept
+{
+	m_height = 0;
+	for (const IGlyph *pChild : m_children)
+	{
+		m_height = std::max(m_height, pChild->VGetHeight());
+	}
+}
+
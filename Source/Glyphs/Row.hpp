@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * @file   Row.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Row of glyphs (composite).
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_ROW_HPP
+#define LEXI_ROW_HPP
+
+namespace Lexi
+{
+	class Row;
+	LEXI_DECLARE_PTR(Row);
+
+	/**
+	 * Horizontal run of glyphs (GoF Composite).
+	 *
+	 * Children are referenced, not owned: characters belong to their
+	 * CharacterPool, so a row costs one pointer per character. Positions are
+	 * computed here from the widths of the preceding children instead of
+	 * being stored in the (shared) glyphs.
+	 *
+	 * Rows are allocator-aware: one created by GlyphArena::Create() keeps its
+	 * child list in the arena as well.
+	 */
+	class Row final : public IGlyph
+	{
+	public:
+		using allocator_type = std::pmr::polymorphic_allocator<>;
+	private:
+		std::pmr::vector<const IGlyph *> m_children;
+		std::int32_t m_width; //!< Sum of the children's widths
+		std::int32_t m_height; //!< Tallest child
+	public:
+		Row(void);
+		explicit Row(const allocator_type &kAllocator);
+
+		void Append(const IGlyph &kGlyph);
+		void Insert(std::size_t index, const IGlyph &kGlyph);
+		void Remove(std::size_t index);
+		//! Reserve space for a number of children.
+		void Reserve(std::size_t numChildren);
+		//! Visits every child, then the row itself.
+		void VAccept(IVisitor &visitor) const override;
+		/**
+		 * Visit without virtual dispatch, as VAccept.
+		 *
+		 * Characters & rows are recognized by their kind; other glyphs are
+		 * still visited through VAccept(). Glyphs of kinds the visitor
+		 * doesn't need (Visitor::kGLYPH_KINDS) are skipped.
+		 */
+		template <StaticVisitorType Visitor>
+		void Accept(Visitor &visitor) const;
+		std::int32_t VGetWidth(void) const noexcept override;
+		std::int32_t VGetHeight(void) const noexcept override;
+		//! Compute the position of a child relative to the row's origin.
+		Point GetChildPosition(std::size_t index) const;
+		/**
+		 * Invoke func(const IGlyph &, Point) for every child & its position.
+		 *
+		 * Positions are accumulated in one pass, starting at origin.
+		 */
+		template <typename Func>
+		void ForEachChild(Point origin, Func &&func) const;
+		// Accessors:
+		allocator_type get_allocator(void) const noexcept;
+		const IGlyph &GetChild(std::size_t index) const;
+		std::size_t GetNumChildren(void) const noexcept;
+		//! Retrieve the memory used by the row itself (children are shared).
+		std::size_t GetMemoryUsage(void) const noexcept;
+	private:
+		void UpdateHeight(void) noexcept;
+	};
+
+	template <StaticVisitorType Visitor>
+	inline void Row::Accept(Visitor &visitor) const
+	{
+		constexpr GlyphKindMask kKinds = Visitor::kGLYPH_KINDS;
+		for (const IGlyph *pChild : m_children)
+		{
+			switch (pChild->GetKind())
+			{
+			case GlyphKind::kCharacter:
+				if constexpr ((kKinds & kGLYPH_KIND_MASK<GlyphKind::kCharacter>) != 0)
+				{
+					static_cast<const Character *>(pChild)->Accept(visitor);
+				}
+				break;
+			case GlyphKind::kRow:
+				static_cast<const Row *>(pChild)->Accept(visitor);
+				break;
+			default:
+				if constexpr ((kKinds & kGLYPH_KIND_MASK<GlyphKind::kImage, GlyphKind::kOther>) != 0)
+				{
+					pChild->VAccept(visitor);
+				}
+				break;
+			}
+		}
+
+		if constexpr ((kKinds & kGLYPH_KIND_MASK<GlyphKind::kRow>) != 0)
+		{
+			visitor.VisitRow();
+		}
+	}
+
+	template <typename Func>
+	inline void Row::ForEachChild(Point origin, Func &&func) const
+	{
+		for (const IGlyph *pChild : m_children)
+		{
+			func(*pChild, origin);
+			origin.x += pChild->VGetWidth();
+		}
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_ROW_HPP */
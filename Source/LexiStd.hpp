@@ -40,25 +40,32 @@
 #include <cstdlib>
 #include <cstring>
 #include <cstdarg>
+#include <cctype>
 #include <cmath>
 #include <iostream>
 #include <fstream>
 #include <iomanip>
 #include <format>
 #include <memory>
+#include <memory_resource>
 #include <new>
 #include <optional>
+#include <tuple>
 #include <string>
 #include <string_view>
+#include <array>
 #include <vector>
 #include <list>
+#include <deque>
 #include <map>
 #include <unordered_map>
+#include <bitset>
 #include <span>
 #include <type_traits>
 #include <concepts>
 #include <numeric>
 #include <numbers>
+#include <bit>
 #include <limits>
 #include <algorithm>
 #include <compare>
@@ -67,6 +74,11 @@
 #include <exception>
 #include <source_location>
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <future>
 #include <filesystem>
 #include <functional>
 #include <ranges>
@@ -75,14 +87,49 @@
 #include "Utils/Interfaces.hpp"
 #include "Utils/Templates.hpp"
 #include "Utils/Utils.hpp"
+#include "Utils/Unicode.hpp"
 #include "Utils/Exception.hpp"
 #include "Utils/Logger.hpp"
 #include "Utils/Config.hpp"
+#include "Utils/MemoryMappedFile.hpp"
+#include "Utils/ThreadPool.hpp"
+#include "Utils/ReadCopyUpdate.hpp"
+#include "Utils/FileWatcher.hpp"
 // All project headers:
 #include "Commands/ICommand.hpp"
 #include "Commands/QuitCommand.hpp"
+#include "Spelling/WordTokenizer.hpp"
+#include "Spelling/CaseFolding.hpp"
+#include "Spelling/IDictionary.hpp"
+#include "Spelling/HashDictionary.hpp"
+#include "Spelling/DawgDictionary.hpp"
+#include "Spelling/AffixDictionary.hpp"
+#include "Spelling/BloomFilter.hpp"
+#include "Spelling/FilteredDictionary.hpp"
+#include "Spelling/MutableDictionary.hpp"
+#include "Spelling/ReloadableDictionary.hpp"
+#include "Spelling/LayeredDictionary.hpp"
+#include "Spelling/DictionaryRegistry.hpp"
+#include "Spelling/SuggestionEngine.hpp"
+#include "Spelling/IncrementalSpellChecker.hpp"
+#include "Spelling/BackgroundSpellChecker.hpp"
+#include "Spelling/BatchSpellChecker.hpp"
 #include "Visitors/IVisitor.hpp"
+#include "Glyphs/IGlyph.hpp"
+#include "Glyphs/GlyphArena.hpp"
+#include "Glyphs/Character.hpp"
+#include "Glyphs/CharacterPool.hpp"
+#include "Glyphs/Row.hpp"
+#include "Glyphs/GlyphBlock.hpp"
+#include "Visitors/StaticVisitor.hpp"
 #include "Visitors/SpellCheckVisitor.hpp"
+#include "Visitors/WordCountVisitor.hpp"
+#include "Visitors/FusedVisitor.hpp"
+#include "Compositors/ICompositor.hpp"
+#include "Compositors/SimpleCompositor.hpp"
+#include "Compositors/TeXCompositor.hpp"
+#include "Compositors/Composition.hpp"
+#include "Document/PieceTable.hpp"
 
 //! Primary namespace.
 namespace Lexi
@@ -36,9 +36,28 @@ using namespace Lexi;
 using namespace tinyxml2;
 
 static XMLElement *LoadConfig(XMLDocument &xmlDoc);
+//! Log the checked misspellings of text with suggestions.
+static void ReportMisspellings(SpellCheckVisitor &spellChecker, std::string_view text);
+//! Retrieve the UTF-8 text of a row of characters.
+static std::string GetRowText(const Row &kRow);
+/**
+ * Spell check files without opening a window (--spellcheck).
+ *
+ * Returns 0 if every file is spelled correctly, 1 if misspellings were
+ * found and 2 if a file could not be checked.
+ */
+static int RunBatchSpellCheck(std::span<char *> args);
 
 int main(int numArgs, char *pArgs[]) try
 {
+	const auto kStartTime = std::chrono::steady_clock::now();
+	// Log how far into startup a milestone was reached.
+	auto logStartup = [kStartTime](std::string_view milestone)
+	{
+		LEXI_LOG("Startup: {} after {:.1f} ms.", milestone,
+				 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - kStartTime).count());
+	};
+
 	XMLDocument xmlDoc;
 	auto *pRoot = LoadConfig(xmlDoc);
 
@@ -50,7 +69,13 @@ int main(int numArgs, char *pArgs[]) try
 	//logger.RedirectLevelTo(Logger::Level::Msg, outFile);
 	//logger.RedirectLevelTo(Logger::Level::Err, outFile);
 	
+	if (numArgs > 1 && std::string_view(pArgs[1]) == "--spellcheck")
+	{
+		return RunBatchSpellCheck(std::span<char *>(pArgs + 2, static_cast<std::size_t>(numArgs - 2)));
+	}
+
 	LEXI_LOG("Starting application...");
+	logStartup("configuration loaded");
 	
 	LEXI_LOG("Program name: {}", config.GetApp().programName);
 	LEXI_LOG("Description: {}", config.GetApp().description);
@@ -60,23 +85,21 @@ int main(int numArgs, char *pArgs[]) try
 	UniqueICommandPtr pCommand = std::make_unique<QuitCommand>();
 	pCommand->VExecute();
 
-	UniqueSpellCheckVisitorPtr pSpellChecker = std::make_unique<SpellCheckVisitor>();
+	// The dictionary loads on the pool while the window is created; checks requested meanwhile are queued.
+	ThreadPool threadPool;
+	DictionaryRegistry &registry = DictionaryRegistry::Get();
+	UniqueSpellCheckVisitorPtr pSpellChecker = std::make_unique<SpellCheckVisitor>(
+		registry.AcquireConfiguredAsync(threadPool), registry.GetUserDictionary());
 	std::string test = "What's up dood?";
 
-	for (auto ch : test)
-	{
-		pSpellChecker->VVisitCharacter(ch);
-	}
-
-	for (const auto &kMisspelling : pSpellChecker->GetMisspellings())
-	{
-		LEXI_LOG("Misspelled: '{}'", kMisspelling);
-	}
+	pSpellChecker->VVisitText(test);
+	pSpellChecker->VVisitRow();
+	logStartup("spell check requested");
 
 	Display *pDisplay = nullptr;
 	Window window;
 	XEvent event;
-	constexpr std::string_view kMESSAGE = "Hello, world!";
+	constexpr int kMARGIN = 20;
 	int defaultScreen = 0;
 
 	pDisplay = XOpenDisplay(nullptr);
@@ -93,24 +116,88 @@ int main(int numArgs, char *pArgs[]) try
 								 WhitePixel(pDisplay, defaultScreen));
 
 	XStoreName(pDisplay, window, config.GetApp().programName.c_str());
-	XSelectInput(pDisplay, window, ExposureMask | KeyPressMask);
+	XSelectInput(pDisplay, window, ExposureMask | KeyPressMask | StructureNotifyMask);
 
 	XMapWindow(pDisplay, window);
+	XFlush(pDisplay);
+	logStartup("window mapped");
 
+	// Lay the document out in cells of the default font.
+	GC gc = DefaultGC(pDisplay, defaultScreen);
+	int fontAscent = 10;
+	std::uint16_t cellWidth = 6;
+	std::uint16_t lineHeight = 13;
+	if (XFontStruct *pFont = XQueryFont(pDisplay, XGContextFromGC(gc)))
+	{
+		fontAscent = pFont->ascent;
+		cellWidth = static_cast<std::uint16_t>(pFont->max_bounds.width);
+		lineHeight = static_cast<std::uint16_t>(pFont->ascent + pFont->descent);
+		XFreeFontInfo(nullptr, pFont, 1);
+	}
+
+	// The characters live in the document's arena (released when it goes, after the pool), its rows in their paragraphs'.
+	GlyphArena documentArena;
+	CharacterPool pool(&documentArena);
+	const StyleId kStyle = pool.AddStyle(TextStyle{ "fixed", cellWidth, lineHeight });
+	Composition composition(std::make_unique<TeXCompositor>(), 800 - 2 * kMARGIN, 0, lineHeight);
+	composition.Assign(test, pool, kStyle);
+
+	// Whole-document passes run on the pool so they never block the event loop.
+	UniqueBackgroundSpellCheckerPtr pBackgroundChecker;
+	constexpr std::chrono::milliseconds kIDLE_POLL(10);
 	bool bRunning = true;
+	bool bFirstFrame = true;
+	bool bReportedCheck = false;
 	while (bRunning)
 	{
+		if (!pBackgroundChecker && !XPending(pDisplay))
+		{
+			// Nothing to draw, wait for the dictionary (but keep handling events).
+			if (pSpellChecker->WaitForDictionary(kIDLE_POLL))
+			{
+				logStartup("dictionary loaded");
+				ReportMisspellings(*pSpellChecker, test);
+				pBackgroundChecker = std::make_unique<BackgroundSpellChecker>(pSpellChecker->GetDictionary(),
+																			  threadPool);
+				pBackgroundChecker->Start({test});
+				if (config.GetUser().bHotReload)
+				{
+					registry.EnableHotReload();
+				}
+			}
+
+			continue;
+		}
+
 		XNextEvent(pDisplay, &event);
 
 		switch (event.type)
 		{
+		case ConfigureNotify:
+			composition.SetLineWidth(std::max(event.xconfigure.width - 2 * kMARGIN, static_cast<int>(cellWidth)));
+			break;
 		case Expose:
-			XFillRectangle(pDisplay, window,
-						   DefaultGC(pDisplay, defaultScreen),
-						   20, 20, 10, 10);
-			XDrawString(pDisplay, window,
-						DefaultGC(pDisplay, defaultScreen),
-						50, 50, kMESSAGE.data(), kMESSAGE.size());
+			// Only dirty paragraphs are laid out again (on the pool after a resize), then the exposed rows are drawn.
+			composition.Compose(threadPool);
+			composition.ForEachRow(event.xexpose.y - kMARGIN, event.xexpose.y + event.xexpose.height - kMARGIN,
+								   [&](const Row &kRow, Point origin)
+			{
+				const std::string kText = GetRowText(kRow);
+				XDrawString(pDisplay, window, gc, kMARGIN, kMARGIN + origin.y + fontAscent, kText.data(),
+							static_cast<int>(kText.size()));
+			});
+			if (bFirstFrame)
+			{
+				logStartup("first frame drawn");
+				bFirstFrame = false;
+			}
+
+			if (!bReportedCheck && pBackgroundChecker && pBackgroundChecker->IsDone())
+			{
+				LEXI_LOG("Background spell check: {} misspelling(s) on {} thread(s).",
+						 pBackgroundChecker->GetMisspellings().size(), threadPool.GetNumThreads());
+				bReportedCheck = true;
+			}
 			break;
 		case KeyPress:
 			bRunning = false;
@@ -119,8 +206,20 @@ int main(int numArgs, char *pArgs[]) try
 	}
 
 	XCloseDisplay(pDisplay);
+
+	const Composition::Stats &kLayoutStats = composition.GetStats();
+	LEXI_LOG("Layout ({}): {} pass(es), {} in parallel, {} paragraph(s) composed, {} moved, longest pass {:.3f} ms.",
+			 composition.GetCompositor().VGetName(), kLayoutStats.numPasses, kLayoutStats.numParallelPasses,
+			 kLayoutStats.numParagraphsComposed, kLayoutStats.numParagraphsMoved, kLayoutStats.maxPassSeconds * 1000.0);
+	const GlyphArena::Stats kCharacterMemory = documentArena.GetStats();
+	const GlyphArena::Stats kRowMemory = composition.GetRowMemoryStats();
+	LEXI_LOG("Glyph memory: {} of {} byte(s) used by characters, {} of {} byte(s) by rows ({} chunk(s)).",
+			 kCharacterMemory.numBytesAllocated, kCharacterMemory.numBytesReserved, kRowMemory.numBytesAllocated,
+			 kRowMemory.numBytesReserved, kRowMemory.numChunks);
 	
 	config.Save(pRoot);
+	registry.DisableHotReload();
+	registry.SaveUserDictionary();
 	
 	LEXI_LOG("Quitting application...");
 	return 0;
@@ -144,3 +243,69 @@ XMLElement *LoadConfig(XMLDocument &xmlDoc)
 	return pRoot;
 }
 
+void ReportMisspellings(SpellCheckVisitor &spellChecker, std::string_view text)
+{
+	for (const auto &kMisspelling : spellChecker.GetMisspellings())
+	{
+		const auto kWord = text.substr(kMisspelling.range.offset, kMisspelling.range.length);
+		std::string suggestions;
+		for (const auto &kSuggestion : spellChecker.Suggest(kWord).candidates)
+		{
+			suggestions += std::format("{}{}", suggestions.empty() ? "" : ", ", kSuggestion.word);
+		}
+
+		LEXI_LOG("Misspelled: '{}' at {} ({}, suggestions: {})", kWord, kMisspelling.range.offset,
+				 SpellCheckVisitor::MissReasonToString(kMisspelling.reason), suggestions);
+	}
+
+	if (const auto *pReloadable = dynamic_cast<const ReloadableDictionary *>(&spellChecker.GetDictionary().GetBase()))
+	{
+		pReloadable->Read([](const IDictionary &kDictionary)
+		{
+			if (const auto *pFiltered = dynamic_cast<const FilteredDictionary *>(&kDictionary))
+			{
+				const auto kStats = pFiltered->GetStats();
+				LEXI_LOG("Dictionary filter: {} lookups, {:.1f}% hit rate, {:.2f}% false positive rate.",
+						 kStats.numQueries, kStats.GetHitRate() * 100.0, kStats.GetFalsePositiveRate() * 100.0);
+			}
+		});
+	}
+}
+
+std::string GetRowText(const Row &kRow)
+{
+	std::string text;
+	for (std::size_t index = 0; index < kRow.GetNumChildren(); ++index)
+	{
+		const IGlyph &kChild = kRow.GetChild(index);
+		if (kChild.GetKind() == GlyphKind::kCharacter)
+		{
+			char bytes[Unicode::kMAX_SEQUENCE_LENGTH];
+			text.append(bytes, static_cast<const Character &>(kChild).Encode(bytes));
+		}
+	}
+
+	return text;
+}
+
+int RunBatchSpellCheck(std::span<char *> args)
+{
+	const std::vector<std::string_view> kArgs(args.begin(), args.end());
+	const auto kPaths = BatchSpellChecker::CollectFiles(kArgs, std::cin);
+	if (kPaths.empty())
+	{
+		LEXI_ERR("Usage: Lexi --spellcheck <file | directory | -> ...");
+		return 2;
+	}
+
+	ThreadPool threadPool;
+	DictionaryRegistry &registry = DictionaryRegistry::Get();
+	const BatchSpellChecker kChecker(registry.AcquireConfigured(), registry.GetUserDictionary(), threadPool);
+	const auto kStats = kChecker.Run(kPaths, std::cout);
+
+	LEXI_LOG("Checked {} file(s) ({} failed, {} bytes) on {} thread(s) in {:.3f} s: {:.1f} files/s, {:.1f} MB/s, "
+			 "{} misspelling(s).", kStats.numFiles, kStats.numFailed, kStats.numBytes, threadPool.GetNumThreads(),
+			 kStats.seconds, kStats.GetFilesPerSecond(), kStats.GetMegabytesPerSecond(), kStats.numMisspellings);
+	return (kStats.numFailed > 0) ? 2 : (kStats.numMisspellings > 0) ? 1 : 0;
+}
+
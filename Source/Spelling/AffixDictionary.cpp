@@ -0,0 +1,622 @@
+/*******************************************************************************
+ * @file   AffixDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Stem & affix rule dictionary (Hunspell format).
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "AffixDictionary.hpp"
+
+using Lexi::AffixDictionary;
+
+namespace
+{
+	constexpr std::string_view kSPACE = " \t\r\v\f";
+	constexpr std::size_t kMIN_CAPACITY = 16;
+
+	//! Split a line into whitespace separated fields.
+	std::vector<std::string_view> SplitFields(std::string_view line)
+	{
+		std::vector<std::string_view> fields;
+		for (std::size_t start = line.find_first_not_of(kSPACE); start != std::string_view::npos;
+			 start = line.find_first_not_of(kSPACE, start))
+		{
+			const std::size_t kEnd = std::min(line.find_first_of(kSPACE, start), line.size());
+			fields.push_back(line.substr(start, kEnd - start));
+			start = kEnd;
+		}
+
+		return fields;
+	}
+
+	//! Invoke func(line, lineNumber) for every line of text.
+	template <typename Func>
+	void ForEachLine(std::string_view text, Func &&func)
+	{
+		std::size_t lineNumber = 1;
+		for (std::size_t lineStart = 0; lineStart < text.size(); ++lineNumber)
+		{
+			const std::size_t kLineEnd = std::min(text.find('\n', lineStart), text.size());
+			func(text.substr(lineStart, kLineEnd - lineStart), lineNumber);
+			lineStart = kLineEnd + 1;
+		}
+	}
+
+	//! "0" stands for the empty string in strip & affix fields.
+	std::string_view ParseAffixField(std::string_view field)
+	{
+		// Continuation classes ("affix/flags") are not supported, so their flags are dropped.
+		field = field.substr(0, field.find('/'));
+		return (field == "0") ? std::string_view{} : field;
+	}
+}
+
+template <typename Func>
+inline bool AffixDictionary::AnyMatchingRule(const AffixTable &kTable, std::string_view word, bool bSuffix, Func &&func)
+{
+	if (word.empty())
+	{
+		return false;
+	}
+
+	const auto kEdgeByte = static_cast<unsigned char>(bSuffix ? word.back() : word.front());
+	const auto kRules = std::span(kTable.rules);
+	for (const AffixRule &kRule : kRules.first(kTable.numEmptyAffixes))
+	{
+		if (func(kRule))
+		{
+			return true;
+		}
+	}
+
+	for (const AffixRule &kRule : kRules.subspan(kTable.groupStarts[kEdgeByte],
+												 kTable.groupStarts[kEdgeByte + 1] - kTable.groupStarts[kEdgeByte]))
+	{
+		if ((bSuffix ? word.ends_with(kRule.affix) : word.starts_with(kRule.affix)) && func(kRule))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+AffixDictionary::AffixDictionary(const std::filesystem::path &kPath)
+	: AffixDictionary(MemoryMappedFile(std::filesystem::path(kPath).replace_extension(".aff")).GetText(),
+					  MemoryMappedFile(std::filesystem::path(kPath).replace_extension(".dic")).GetText())
+{
+}
+
+AffixDictionary::AffixDictionary(std::string_view affixText, std::string_view dictionaryText)
+	: m_prefixes{},
+	  m_suffixes{},
+	  m_aliases{},
+	  m_pool{},
+	  m_slots(kMIN_CAPACITY),
+	  m_flagSets{},
+	  m_numStems(0),
+	  m_numForms(0)
+{
+	ParseAffixes(affixText);
+	ParseStems(dictionaryText);
+	VForEachWord([this](std::string_view) { ++m_numForms; });
+}
+
+bool AffixDictionary::VContains(std::string_view word) const
+{
+	if (word.empty() || word.size() > kMAX_STEM_LENGTH)
+	{
+		return false;
+	}
+	// Stems are matched as listed, so try the spellings the CaseFolding rules accept.
+	if (ContainsSpelling(word))
+	{
+		return true;
+	}
+
+	const WordCase kCase = CaseFolding::GetWordCase(word);
+	if (kCase != WordCase::kCapitalized && kCase != WordCase::kUpper)
+	{
+		return false;
+	}
+
+	std::string spelling(word);
+	CaseFolding::FoldWord(spelling, spelling.data());
+	if (ContainsSpelling(spelling))
+	{
+		return true;
+	}
+	// All caps also matches capitalized stems ("PARIS").
+	CaseFolding::CapitalizeWord(spelling, spelling.data());
+	return kCase == WordCase::kUpper && ContainsSpelling(spelling);
+}
+
+void AffixDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	std::string form;
+	const auto kApplyPrefixes = [&](std::string_view stem, std::string_view word, const FlagSet &kFlags,
+									bool bCrossOnly)
+	{
+		for (const AffixRule &kPrefix : m_prefixes.rules)
+		{
+			if (kFlags.test(static_cast<unsigned char>(kPrefix.flag)) && (!bCrossOnly || kPrefix.bCrossProduct) &&
+				word.starts_with(kPrefix.strip) && MatchesCondition(kPrefix.condition, stem, false))
+			{
+				form.assign(kPrefix.affix);
+				form.append(word.substr(kPrefix.strip.size()));
+				kFunc(form);
+			}
+		}
+	};
+
+	std::string suffixed;
+	for (const StemSlot &kSlot : m_slots)
+	{
+		if (kSlot.length == 0)
+		{
+			continue;
+		}
+
+		const std::string_view kStem = GetSlotStem(kSlot);
+		const FlagSet &kFlags = m_flagSets[kSlot.flagSet];
+		kFunc(kStem);
+		for (const AffixRule &kSuffix : m_suffixes.rules)
+		{
+			if (!kFlags.test(static_cast<unsigned char>(kSuffix.flag)) || !kStem.ends_with(kSuffix.strip) ||
+				!MatchesCondition(kSuffix.condition, kStem, true))
+			{
+				continue;
+			}
+
+			suffixed.assign(kStem.substr(0, kStem.size() - kSuffix.strip.size()));
+			suffixed.append(kSuffix.affix);
+			kFunc(suffixed);
+			if (kSuffix.bCrossProduct)
+			{
+				kApplyPrefixes(kStem, suffixed, kFlags, true);
+			}
+		}
+
+		kApplyPrefixes(kStem, kStem, kFlags, false);
+	}
+}
+
+std::size_t AffixDictionary::VGetSize(void) const noexcept
+{
+	return m_numForms;
+}
+
+std::size_t AffixDictionary::VGetMemoryUsage(void) const noexcept
+{
+	const auto kGetTableUsage = [](const AffixTable &kTable)
+	{
+		std::size_t numBytes = kTable.rules.capacity() * sizeof(AffixRule);
+		for (const AffixRule &kRule : kTable.rules)
+		{
+			numBytes += kRule.condition.capacity() * sizeof(ConditionElement);
+		}
+
+		return numBytes;
+	};
+
+	return sizeof(*this) + kGetTableUsage(m_prefixes) + kGetTableUsage(m_suffixes) +
+		m_aliases.capacity() * sizeof(std::string) + m_pool.capacity() + m_slots.capacity() * sizeof(StemSlot) +
+		m_flagSets.capacity() * sizeof(FlagSet);
+}
+
+std::size_t AffixDictionary::GetNumStems(void) const noexcept
+{
+	return m_numStems;
+}
+
+std::size_t AffixDictionary::GetNumRules(void) const noexcept
+{
+	return m_prefixes.rules.size() + m_suffixes.rules.size();
+}
+
+bool AffixDictionary::IsAffixFile(const std::filesystem::path &kPath)
+{
+	return kPath.extension() == ".dic" || kPath.extension() == ".aff";
+}
+
+void AffixDictionary::ParseAffixes(std::string_view text)
+{
+	AffixTable *pTable = nullptr; // Table of the rule group being read
+	std::size_t numGroupRules = 0; // Rules left in that group
+	char groupFlag = '\0';
+	bool bGroupCrossProduct = false;
+	std::size_t numAliases = 0;
+
+	ForEachLine(text, [&](std::string_view line, std::size_t lineNumber)
+	{
+		const auto kFields = SplitFields(line);
+		if (kFields.empty() || kFields.front().starts_with('#'))
+		{
+			return;
+		}
+
+		const auto kThrowIf = [lineNumber](bool bFailed, std::string_view message)
+		{
+			LEXI_THROW_IF(bFailed, std::format("Affix file line {}: {}", lineNumber, message));
+		};
+		const std::string_view kKeyword = kFields.front();
+		if (kKeyword == "SET")
+		{
+			kThrowIf(kFields.size() < 2 || kFields[1] != "UTF-8", "only UTF-8 dictionaries are supported!");
+		}
+		else if (kKeyword == "FLAG")
+		{
+			kThrowIf(kFields.size() < 2 || kFields[1] != "UTF-8", "only single character flags are supported!");
+		}
+		else if (kKeyword == "AF" && kFields.size() >= 2)
+		{
+			// The first AF line holds the number of aliases, the others one alias each.
+			if (numAliases == 0 && m_aliases.empty())
+			{
+				numAliases = static_cast<std::size_t>(std::strtoull(std::string(kFields[1]).c_str(), nullptr, 10));
+				m_aliases.reserve(numAliases);
+			}
+			else
+			{
+				m_aliases.emplace_back(kFields[1]);
+			}
+		}
+		else if (kKeyword == "PFX" || kKeyword == "SFX")
+		{
+			AffixTable &table = (kKeyword == "PFX") ? m_prefixes : m_suffixes;
+			kThrowIf(kFields.size() < 4, "affix rule is missing fields!");
+			kThrowIf(kFields[1].size() != 1 || !Unicode::IsAscii(kFields[1].front()),
+					 "only single character flags are supported!");
+			if (numGroupRules == 0 || pTable != &table || groupFlag != kFields[1].front())
+			{
+				// Group header: flag, cross product & number of rules.
+				pTable = &table;
+				groupFlag = kFields[1].front();
+				bGroupCrossProduct = kFields[2] == "Y";
+				numGroupRules = static_cast<std::size_t>(std::strtoull(std::string(kFields[3]).c_str(), nullptr, 10));
+				return;
+			}
+
+			table.rules.push_back(AffixRule{
+				std::string(ParseAffixField(kFields[2])),
+				std::string(ParseAffixField(kFields[3])),
+				ParseCondition((kFields.size() > 4) ? kFields[4] : "."),
+				groupFlag,
+				bGroupCrossProduct
+			});
+			--numGroupRules;
+		}
+	});
+
+	BuildIndex(m_prefixes, false);
+	BuildIndex(m_suffixes, true);
+}
+
+void AffixDictionary::ParseStems(std::string_view text)
+{
+	std::unordered_map<FlagSet, std::uint16_t> flagSetIndices;
+	bool bFirstLine = true;
+	ForEachLine(text, [&](std::string_view line, std::size_t)
+	{
+		const std::size_t kStart = line.find_first_not_of(kSPACE);
+		if (kStart == std::string_view::npos)
+		{
+			return;
+		}
+
+		line = line.substr(kStart);
+		line = line.substr(0, line.find_first_of(kSPACE)); // Morphological fields follow the entry
+		const bool kbCountLine = bFirstLine && std::ranges::all_of(line, [](char ch) { return ch >= '0' && ch <= '9'; });
+		bFirstLine = false;
+		if (kbCountLine)
+		{
+			// The first line holds the number of entries.
+			const std::size_t kNumEntries = static_cast<std::size_t>(std::strtoull(std::string(line).c_str(), nullptr, 10));
+			Rehash(std::bit_ceil(std::max(kMIN_CAPACITY, kNumEntries * 4 / 3 + 1)));
+			m_pool.reserve(text.size());
+			return;
+		}
+
+		const std::size_t kSlash = line.find('/');
+		const std::string_view kStem = line.substr(0, kSlash);
+		const FlagSet kFlags = (kSlash != std::string_view::npos) ? ParseFlags(line.substr(kSlash + 1)) : FlagSet{};
+		if (!kStem.empty() && kStem.size() <= kMAX_STEM_LENGTH)
+		{
+			AddStem(kStem, kFlags, flagSetIndices);
+		}
+	});
+}
+
+void AffixDictionary::AddStem(std::string_view stem, const FlagSet &kFlags,
+							  std::unordered_map<FlagSet, std::uint16_t> &flagSetIndices)
+{
+	const auto kGetFlagSetIndex = [&](const FlagSet &kSet)
+	{
+		const auto [kIter, kbInserted] = flagSetIndices.try_emplace(kSet, static_cast<std::uint16_t>(m_flagSets.size()));
+		if (kbInserted)
+		{
+			LEXI_THROW_IF(m_flagSets.size() > std::numeric_limits<std::uint16_t>::max(), "Too many distinct affix flag sets!");
+			m_flagSets.push_back(kSet);
+		}
+
+		return kIter->second;
+	};
+
+	const std::size_t kMask = m_slots.size() - 1;
+	std::size_t index = HashStem(stem) & kMask;
+	for (; m_slots[index].length != 0; index = (index + 1) & kMask)
+	{
+		StemSlot &slot = m_slots[index];
+		if (GetSlotStem(slot) == stem)
+		{
+			// Listed again (a homonym), it takes the rules of both entries.
+			slot.flagSet = kGetFlagSetIndex(m_flagSets[slot.flagSet] | kFlags);
+			return;
+		}
+	}
+
+	LEXI_THROW_IF(m_pool.size() + stem.size() > std::numeric_limits<std::uint32_t>::max(), "Affix dictionary is too large!");
+	m_slots[index] = StemSlot{ static_cast<std::uint32_t>(m_pool.size()), static_cast<std::uint16_t>(stem.size()),
+							   kGetFlagSetIndex(kFlags) };
+	m_pool.insert(m_pool.end(), stem.begin(), stem.end());
+	if (++m_numStems * 4 > m_slots.size() * 3)
+	{
+		Rehash(m_slots.size() * 2);
+	}
+}
+
+void AffixDictionary::Rehash(std::size_t capacity)
+{
+	std::vector<StemSlot> oldSlots(capacity);
+	oldSlots.swap(m_slots);
+
+	const std::size_t kMask = m_slots.size() - 1;
+	for (const StemSlot &kSlot : oldSlots)
+	{
+		if (kSlot.length == 0)
+		{
+			continue;
+		}
+
+		std::size_t index = HashStem(GetSlotStem(kSlot)) & kMask;
+		while (m_slots[index].length != 0)
+		{
+			index = (index + 1) & kMask;
+		}
+
+		m_slots[index] = kSlot;
+	}
+}
+
+const AffixDictionary::FlagSet *AffixDictionary::FindStem(std::string_view stem) const noexcept
+{
+	const std::size_t kMask = m_slots.size() - 1;
+	// The load factor guarantees an empty slot, so probing always terminates.
+	for (std::size_t index = HashStem(stem) & kMask; m_slots[index].length != 0; index = (index + 1) & kMask)
+	{
+		const StemSlot &kSlot = m_slots[index];
+		if (kSlot.length == stem.size() && GetSlotStem(kSlot) == stem)
+		{
+			return &m_flagSets[kSlot.flagSet];
+		}
+	}
+
+	return nullptr;
+}
+
+bool AffixDictionary::ContainsSpelling(std::string_view word) const
+{
+	if (FindStem(word) != nullptr)
+	{
+		return true;
+	}
+
+	std::string stem;
+	if (ContainsWithSuffix(word, nullptr, stem))
+	{
+		return true;
+	}
+
+	std::string unprefixed;
+	return AnyMatchingRule(m_prefixes, word, false, [&](const AffixRule &kPrefix)
+	{
+		unprefixed.assign(kPrefix.strip);
+		unprefixed.append(word.substr(kPrefix.affix.size()));
+		if (unprefixed.empty() || !MatchesCondition(kPrefix.condition, unprefixed, false))
+		{
+			return false;
+		}
+
+		const FlagSet *pFlags = FindStem(unprefixed);
+		return (pFlags != nullptr && pFlags->test(static_cast<unsigned char>(kPrefix.flag))) ||
+			(kPrefix.bCrossProduct && ContainsWithSuffix(unprefixed, &kPrefix, stem));
+	});
+}
+
+bool AffixDictionary::ContainsWithSuffix(std::string_view word, const AffixRule *pPrefix, std::string &stem) const
+{
+	return AnyMatchingRule(m_suffixes, word, true, [&](const AffixRule &kSuffix)
+	{
+		if (pPrefix != nullptr && !kSuffix.bCrossProduct)
+		{
+			return false;
+		}
+
+		stem.assign(word.substr(0, word.size() - kSuffix.affix.size()));
+		stem.append(kSuffix.strip);
+		if (stem.empty() || !MatchesCondition(kSuffix.condition, stem, true))
+		{
+			return false;
+		}
+		// With a prefix the stem has to take both rules (the prefix condition was checked on this stem).
+		const FlagSet *pFlags = FindStem(stem);
+		return pFlags != nullptr && pFlags->test(static_cast<unsigned char>(kSuffix.flag)) &&
+			(pPrefix == nullptr || pFlags->test(static_cast<unsigned char>(pPrefix->flag)));
+	});
+}
+
+std::string_view AffixDictionary::GetSlotStem(const StemSlot &kSlot) const noexcept
+{
+	return std::string_view(m_pool.data() + kSlot.offset, kSlot.length);
+}
+
+AffixDictionary::FlagSet AffixDictionary::ParseFlags(std::string_view flags) const
+{
+	if (!m_aliases.empty())
+	{
+		// With aliases, entries reference a flag string by its (1-based) number.
+		const std::size_t kAlias = static_cast<std::size_t>(std::strtoull(std::string(flags).c_str(), nullptr, 10));
+		LEXI_THROW_IF(kAlias == 0 || kAlias > m_aliases.size(), std::format("Unknown affix flag alias \"{}\"!", flags));
+		flags = m_aliases[kAlias - 1];
+	}
+
+	FlagSet flagSet;
+	for (const char kFlag : flags)
+	{
+		LEXI_THROW_IF(!Unicode::IsAscii(kFlag), "Only single character affix flags are supported!");
+		flagSet.set(static_cast<unsigned char>(kFlag));
+	}
+
+	return flagSet;
+}
+
+void AffixDictionary::BuildIndex(AffixTable &table, bool bSuffix)
+{
+	const auto kGetGroup = [bSuffix](const AffixRule &kRule)
+	{
+		// Empty affixes sort before every byte.
+		return kRule.affix.empty() ? -1 : static_cast<int>(static_cast<unsigned char>(bSuffix ? kRule.affix.back()
+																								: kRule.affix.front()));
+	};
+
+	std::ranges::stable_sort(table.rules, {}, kGetGroup);
+	table.numEmptyAffixes = static_cast<std::uint32_t>(std::ranges::count_if(table.rules, [&](const AffixRule &kRule)
+	{
+		return kRule.affix.empty();
+	}));
+	for (std::size_t group = 0; group < table.groupStarts.size(); ++group)
+	{
+		const auto kStart = std::ranges::lower_bound(table.rules, static_cast<int>(group), {}, kGetGroup);
+		table.groupStarts[group] = static_cast<std::uint32_t>(kStart - table.rules.begin());
+	}
+}
+
+AffixDictionary::Condition AffixDictionary::ParseCondition(std::string_view text)
+{
+	Condition condition;
+	for (std::size_t offset = 0; offset < text.size(); )
+	{
+		ConditionElement element{};
+		if (text[offset] == '.')
+		{
+			element.bNegated = true; // Nothing excluded
+			++offset;
+		}
+		else if (text[offset] == '[')
+		{
+			const std::size_t kEnd = text.find(']', offset);
+			LEXI_THROW_IF(kEnd == std::string_view::npos, std::format("Unterminated affix condition \"{}\"!", text));
+			std::string_view chars = text.substr(offset + 1, kEnd - offset - 1);
+			element.bNegated = chars.starts_with('^');
+			chars.remove_prefix(element.bNegated ? 1 : 0);
+			while (!chars.empty())
+			{
+				const Unicode::CodePoint kCodePoint = Unicode::Decode(chars);
+				element.codePoints.push_back(kCodePoint.value);
+				chars.remove_prefix(kCodePoint.length);
+			}
+
+			offset = kEnd + 1;
+		}
+		else
+		{
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(text.substr(offset));
+			element.codePoints.push_back(kCodePoint.value);
+			offset += kCodePoint.length;
+		}
+
+		condition.push_back(std::move(element));
+	}
+	// A lone "." matches everything, so skip the check entirely.
+	if (condition.size() == 1 && condition.front().bNegated && condition.front().codePoints.empty())
+	{
+		condition.clear();
+	}
+
+	return condition;
+}
+
+bool AffixDictionary::MatchesCondition(const Condition &kCondition, std::string_view stem, bool bSuffix) noexcept
+{
+	// Suffix conditions match the last code points of the stem, prefix conditions the first.
+	std::size_t offset = bSuffix ? stem.size() : 0;
+	for (std::size_t index = 0; index < kCondition.size(); ++index)
+	{
+		const ConditionElement &kElement = kCondition[bSuffix ? kCondition.size() - 1 - index : index];
+		if (bSuffix)
+		{
+			if (offset == 0)
+			{
+				return false;
+			}
+
+			do
+			{
+				--offset;
+			} while (offset > 0 && Unicode::IsContinuationByte(stem[offset]));
+		}
+		else if (offset >= stem.size())
+		{
+			return false;
+		}
+
+		const Unicode::CodePoint kCodePoint = Unicode::Decode(stem.substr(offset));
+		const bool kbListed = std::ranges::find(kElement.codePoints, kCodePoint.value) != kElement.codePoints.end();
+		if (kbListed == kElement.bNegated)
+		{
+			return false;
+		}
+
+		offset += bSuffix ? 0 : kCodePoint.length;
+	}
+
+	return true;
+}
+
+std::uint32_t AffixDictionary::HashStem(std::string_view stem) noexcept
+{
+	// 64-bit FNV-1a, folded down to 32 bits.
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (const char kCh : stem)
+	{
+		hash ^= static_cast<unsigned char>(kCh);
+		hash *= 1099511628211ULL;
+	}
+
+	return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
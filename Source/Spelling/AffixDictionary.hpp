@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * @file   AffixDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Stem & affix rule dictionary (Hunspell format).
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_AFFIXDICTIONARY_HPP
+#define LEXI_AFFIXDICTIONARY_HPP
+
+namespace Lexi
+{
+	class AffixDictionary;
+	LEXI_DECLARE_PTR(AffixDictionary);
+
+	/**
+	 * Dictionary of stems & affix rules in the Hunspell .dic/.aff format.
+	 *
+	 * Only stems are stored, each with the flags of the affix rules it takes.
+	 * Inflected forms are recognized by stripping the affixes a word ends (or
+	 * starts) with & looking up the remaining stem, which must carry the
+	 * rule's flag & satisfy its condition.
+	 *
+	 * Rules are compiled when the .aff file is loaded: they are grouped by
+	 * the outermost byte of their affix (the last byte of a suffix, the first
+	 * of a prefix), so a lookup only compares the rules whose affix can match,
+	 * and conditions become code point sets.
+	 *
+	 * Supported subset: PFX & SFX rules (with cross products & conditions),
+	 * single character flags & flag aliases (AF). Files must be UTF-8;
+	 * continuation classes, compounding & the remaining options are ignored.
+	 */
+	class AffixDictionary final : public IDictionary
+	{
+	public:
+		static constexpr std::size_t kMAX_FLAGS = 128; //!< Flags are ASCII characters
+		using FlagSet = std::bitset<kMAX_FLAGS>;
+	private:
+		//! A single character of a condition: a set of code points (negated, "." is the empty negated set).
+		struct ConditionElement
+		{
+			std::u32string codePoints;
+			bool bNegated;
+		};
+		using Condition = std::vector<ConditionElement>;
+		//! Compiled PFX or SFX rule.
+		struct AffixRule
+		{
+			std::string strip; //!< Removed from the stem before the affix is added
+			std::string affix; //!< Added to the stem
+			Condition condition; //!< Must match the start (prefix) or end (suffix) of the stem
+			char flag; //!< Flag stems carry to take this rule
+			bool bCrossProduct; //!< Combines with the other kind of affix
+		};
+		//! Rules of one kind, grouped by the outermost byte of their affix.
+		struct AffixTable
+		{
+			std::vector<AffixRule> rules; //!< Sorted by group, rules with an empty affix come first
+			std::array<std::uint32_t, 257> groupStarts; //!< Rules of byte b are [groupStarts[b], groupStarts[b + 1])
+			std::uint32_t numEmptyAffixes; //!< Rules with an empty affix (they apply to any word)
+		};
+		//! Stem table slot referencing a stem in the pool.
+		struct StemSlot
+		{
+			std::uint32_t offset; //!< Offset of the stem in the pool
+			std::uint16_t length; //!< Length of the stem (zero if the slot is empty)
+			std::uint16_t flagSet; //!< Index into m_flagSets
+		};
+
+		static constexpr std::size_t kMAX_STEM_LENGTH = std::numeric_limits<std::uint16_t>::max();
+
+		AffixTable m_prefixes;
+		AffixTable m_suffixes;
+		std::vector<std::string> m_aliases; //!< Flag aliases (AF), referenced by number from the .dic file
+		std::vector<char> m_pool; //!< Packed stem characters
+		std::vector<StemSlot> m_slots; //!< Power-of-two sized probe table
+		std::vector<FlagSet> m_flagSets; //!< Distinct flag sets (most stems share a few)
+		std::size_t m_numStems;
+		std::size_t m_numForms; //!< Number of words the stems & rules generate
+	public:
+		/**
+		 * Load a dictionary from a .dic file & the .aff file next to it.
+		 *
+		 * kPath may name either of the two files.
+		 */
+		explicit AffixDictionary(const std::filesystem::path &kPath);
+		//! Load a dictionary from the contents of its .aff & .dic files.
+		AffixDictionary(std::string_view affixText, std::string_view dictionaryText);
+
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const override;
+		//! Generates every form (a form may be visited more than once if several rules produce it).
+		void VForEachWord(const WordFunc &kFunc) const override;
+		//! Retrieve the number of forms generated, as if the dictionary was expanded.
+		std::size_t VGetSize(void) const noexcept override;
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		// Accessors:
+		std::size_t GetNumStems(void) const noexcept;
+		std::size_t GetNumRules(void) const noexcept;
+		//! Determine whether or not a file is part of an affix dictionary (by extension).
+		static bool IsAffixFile(const std::filesystem::path &kPath);
+	private:
+		void ParseAffixes(std::string_view text);
+		void ParseStems(std::string_view text);
+		//! Add a stem (or merge its flags into the listed one), flag sets are shared through flagSetIndices.
+		void AddStem(std::string_view stem, const FlagSet &kFlags,
+					 std::unordered_map<FlagSet, std::uint16_t> &flagSetIndices);
+		void Rehash(std::size_t capacity);
+		std::string_view GetSlotStem(const StemSlot &kSlot) const noexcept;
+		//! Look up a stem as listed, returns its flags or nullptr.
+		const FlagSet *FindStem(std::string_view stem) const noexcept;
+		//! Determine whether or not word is a stem or a stem with affixes, spelled exactly as given.
+		bool ContainsSpelling(std::string_view word) const;
+		//! Try to strip a suffix, if pPrefix is set the stem also has to take that (cross product) prefix.
+		bool ContainsWithSuffix(std::string_view word, const AffixRule *pPrefix, std::string &stem) const;
+		FlagSet ParseFlags(std::string_view flags) const;
+		static void BuildIndex(AffixTable &table, bool bSuffix);
+		//! Invoke func(rule) for the rules whose affix word starts (prefix) or ends (suffix) with, until it returns true.
+		template <typename Func>
+		static bool AnyMatchingRule(const AffixTable &kTable, std::string_view word, bool bSuffix, Func &&func);
+		static Condition ParseCondition(std::string_view text);
+		static bool MatchesCondition(const Condition &kCondition, std::string_view stem, bool bSuffix) noexcept;
+		static std::uint32_t HashStem(std::string_view stem) noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_AFFIXDICTIONARY_HPP */
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * @file   BackgroundSpellChecker.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Spell checking of whole documents on a thread pool.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "BackgroundSpellChecker.hpp"
+
+using Lexi::BackgroundSpellChecker;
+
+//! State of one pass, kept alive by its tasks.
+struct BackgroundSpellChecker::Pass
+{
+	const IDictionary *pDictionary;
+	ThreadPool *pThreadPool;
+	std::size_t rowsPerChunk;
+	std::vector<std::string> rows; //!< Document snapshot
+	std::vector<MisspellingVector> chunkMisspellings; //!< Written by exactly one task each
+	MisspellingVector misspellings; //!< Merged results, valid once bDone
+	std::atomic<std::size_t> numPendingChunks;
+	std::atomic<bool> bCancelled;
+	std::atomic<bool> bFailed; //!< A task threw, the remaining chunks are skipped
+	mutable std::mutex mutex; //!< Guards bDone & pException
+	mutable std::condition_variable doneCondition;
+	bool bDone;
+	std::exception_ptr pException; //!< First exception thrown by a task
+};
+
+static const BackgroundSpellChecker::MisspellingVector s_kNoMisspellings{};
+
+BackgroundSpellChecker::BackgroundSpellChecker(const IDictionary &kDictionary, ThreadPool &threadPool,
+											   std::size_t rowsPerChunk)
+	: m_pDictionary(&kDictionary),
+	  m_pThreadPool(&threadPool),
+	  m_rowsPerChunk(std::max<std::size_t>(1, rowsPerChunk)),
+	  m_generation(0),
+	  m_pPass{},
+	  m_cancelledPasses{}
+{
+}
+
+BackgroundSpellChecker::~BackgroundSpellChecker(void)
+{
+	Cancel();
+	// Tasks reference the dictionary, so they have to drain before it can go away.
+	for (const auto &kpPass : m_cancelledPasses)
+	{
+		std::unique_lock lock(kpPass->mutex);
+		kpPass->doneCondition.wait(lock, [&kpPass]() { return kpPass->bDone; });
+	}
+}
+
+void BackgroundSpellChecker::Start(std::vector<std::string> rows)
+{
+	Cancel();
+	std::erase_if(m_cancelledPasses, [](const StrongPassPtr &kpPass)
+	{
+		std::lock_guard lock(kpPass->mutex);
+		return kpPass->bDone;
+	});
+
+	++m_generation;
+	const std::size_t kNumChunks = (rows.size() + m_rowsPerChunk - 1) / m_rowsPerChunk;
+	m_pPass = std::make_shared<Pass>();
+	m_pPass->pDictionary = m_pDictionary;
+	m_pPass->pThreadPool = m_pThreadPool;
+	m_pPass->rowsPerChunk = m_rowsPerChunk;
+	m_pPass->rows = std::move(rows);
+	m_pPass->chunkMisspellings.resize(kNumChunks);
+	m_pPass->numPendingChunks.store(kNumChunks, std::memory_order_relaxed);
+	m_pPass->bCancelled.store(false, std::memory_order_relaxed);
+	m_pPass->bFailed.store(false, std::memory_order_relaxed);
+	m_pPass->bDone = false;
+	if (kNumChunks == 0)
+	{
+		FinishPass(*m_pPass);
+		return;
+	}
+	// A single root task; the range is split as workers pick it up.
+	m_pThreadPool->Submit([pPass = m_pPass, kNumChunks]() { CheckChunks(pPass, 0, kNumChunks); });
+}
+
+void BackgroundSpellChecker::Cancel(void)
+{
+	if (m_pPass)
+	{
+		m_pPass->bCancelled.store(true, std::memory_order_relaxed);
+		m_cancelledPasses.push_back(std::move(m_pPass));
+	}
+}
+
+bool BackgroundSpellChecker::Wait(void) const
+{
+	if (!m_pPass)
+	{
+		return false;
+	}
+
+	std::unique_lock lock(m_pPass->mutex);
+	m_pPass->doneCondition.wait(lock, [this]() { return m_pPass->bDone; });
+	if (m_pPass->pException)
+	{
+		std::rethrow_exception(m_pPass->pException);
+	}
+
+	return !m_pPass->bCancelled.load(std::memory_order_relaxed);
+}
+
+bool BackgroundSpellChecker::IsDone(void) const
+{
+	if (!m_pPass)
+	{
+		return true;
+	}
+
+	std::lock_guard lock(m_pPass->mutex);
+	return m_pPass->bDone;
+}
+
+const BackgroundSpellChecker::MisspellingVector &BackgroundSpellChecker::GetMisspellings(void) const
+{
+	return IsDone() && m_pPass ? m_pPass->misspellings : s_kNoMisspellings;
+}
+
+std::uint64_t BackgroundSpellChecker::GetGeneration(void) const noexcept
+{
+	return m_generation;
+}
+
+void BackgroundSpellChecker::CheckChunks(StrongPassPtr pPass, std::size_t firstChunk, std::size_t lastChunk)
+{
+	const auto kIsSkipped = [&kPass = *pPass]()
+	{
+		return kPass.bCancelled.load(std::memory_order_relaxed) || kPass.bFailed.load(std::memory_order_relaxed);
+	};
+
+	try
+	{
+		// A skipped (or failed) range counts as done all the same, otherwise the pass never finishes.
+		while (!kIsSkipped() && lastChunk - firstChunk > 1)
+		{
+			const std::size_t kMidChunk = firstChunk + (lastChunk - firstChunk) / 2;
+			pPass->pThreadPool->Submit([pPass, kMidChunk, lastChunk]() { CheckChunks(pPass, kMidChunk, lastChunk); });
+			lastChunk = kMidChunk;
+		}
+
+		const std::size_t kFirstRow = firstChunk * pPass->rowsPerChunk;
+		const std::size_t kLastRow = std::min(kFirstRow + pPass->rowsPerChunk, pPass->rows.size());
+		auto &misspellings = pPass->chunkMisspellings[firstChunk];
+		for (std::size_t rowIndex = kFirstRow; rowIndex < kLastRow && !kIsSkipped() && lastChunk - firstChunk == 1; ++rowIndex)
+		{
+			for (const auto &kRange : IncrementalSpellChecker::CheckText(*pPass->pDictionary, pPass->rows[rowIndex]))
+			{
+				misspellings.push_back({rowIndex, kRange});
+			}
+		}
+	}
+	catch (...)
+	{
+		pPass->bFailed.store(true, std::memory_order_relaxed);
+		std::lock_guard lock(pPass->mutex);
+		if (!pPass->pException)
+		{
+			pPass->pException = std::current_exception();
+		}
+	}
+	// The last chunk to finish publishes the pass.
+	const std::size_t kNumChunksDone = lastChunk - firstChunk;
+	if (pPass->numPendingChunks.fetch_sub(kNumChunksDone, std::memory_order_acq_rel) == kNumChunksDone)
+	{
+		FinishPass(*pPass);
+	}
+}
+
+void BackgroundSpellChecker::FinishPass(Pass &pass)
+{
+	if (!pass.bCancelled.load(std::memory_order_relaxed) && !pass.bFailed.load(std::memory_order_relaxed))
+	{
+		std::size_t numMisspellings = 0;
+		for (const auto &kChunk : pass.chunkMisspellings)
+		{
+			numMisspellings += kChunk.size();
+		}
+		// Chunks are consecutive row ranges, so concatenating them keeps document order.
+		pass.misspellings.reserve(numMisspellings);
+		for (auto &chunk : pass.chunkMisspellings)
+		{
+			pass.misspellings.insert(pass.misspellings.end(), chunk.begin(), chunk.end());
+			chunk = {};
+		}
+	}
+
+	{
+		std::lock_guard lock(pass.mutex);
+		pass.bDone = true;
+	}
+
+	pass.doneCondition.notify_all();
+}
+
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file   BackgroundSpellChecker.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Spell checking of whole documents on a thread pool.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_BACKGROUNDSPELLCHECKER_HPP
+#define LEXI_BACKGROUNDSPELLCHECKER_HPP
+
+namespace Lexi
+{
+	class BackgroundSpellChecker;
+	LEXI_DECLARE_PTR(BackgroundSpellChecker);
+
+	/**
+	 * Spell checks a snapshot of a document off the calling thread.
+	 *
+	 * The rows are split into ranges that are checked on a ThreadPool against
+	 * the shared (read-only) dictionary. Each range task hands half of its
+	 * rows back to the pool until it is down to one chunk, so idle workers
+	 * steal the largest remaining ranges. Results are merged in document
+	 * order once every chunk is done. Starting a new pass cancels the old
+	 * one; the dictionary & pool must outlive the checker.
+	 */
+	class BackgroundSpellChecker final : public INonCopyable
+	{
+	public:
+		//! A misspelled word within a document row.
+		struct Misspelling
+		{
+			std::size_t rowIndex;
+			WordRange range; //!< Offsets relative to the row start
+
+			auto operator<=>(const Misspelling &) const = default;
+		};
+		using MisspellingVector = std::vector<Misspelling>;
+
+		static constexpr std::size_t kDEFAULT_ROWS_PER_CHUNK = 64;
+	private:
+		struct Pass; // State shared with the pass's tasks
+		using StrongPassPtr = std::shared_ptr<Pass>;
+
+		const IDictionary *m_pDictionary;
+		ThreadPool *m_pThreadPool;
+		std::size_t m_rowsPerChunk; //!< Rows checked by one task without splitting
+		std::uint64_t m_generation; //!< Passes started so far
+		StrongPassPtr m_pPass; //!< Running or finished pass, null when cancelled
+		std::vector<StrongPassPtr> m_cancelledPasses; //!< Passes whose tasks may still be running
+	public:
+		BackgroundSpellChecker(const IDictionary &kDictionary, ThreadPool &threadPool,
+							   std::size_t rowsPerChunk = kDEFAULT_ROWS_PER_CHUNK);
+		//! Cancel any pass & wait for its tasks to drain.
+		~BackgroundSpellChecker(void);
+
+		//! Start checking a snapshot of the document, cancelling the running pass.
+		void Start(std::vector<std::string> rows);
+		//! Stop the running pass, its results are discarded.
+		void Cancel(void);
+		/**
+		 * Block until the current pass ends, returns false if it was cancelled (or none was started).
+		 *
+		 * Rethrows the first error a task of the pass threw, its results are then discarded.
+		 */
+		bool Wait(void) const;
+		// Accessors:
+		//! Determine if the current pass has finished (or been cancelled).
+		bool IsDone(void) const;
+		//! Misspellings of the finished pass in document order, empty while it is running.
+		const MisspellingVector &GetMisspellings(void) const;
+		//! Number of passes started so far.
+		std::uint64_t GetGeneration(void) const noexcept;
+	private:
+		//! Check chunks [firstChunk, lastChunk), handing the upper half back to the pool while splitting.
+		static void CheckChunks(StrongPassPtr pPass, std::size_t firstChunk, std::size_t lastChunk);
+		//! Merge the chunk results (unless cancelled) & wake waiters.
+		static void FinishPass(Pass &pass);
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_BACKGROUNDSPELLCHECKER_HPP */
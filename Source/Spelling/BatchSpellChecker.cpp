@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * @file   BatchSpellChecker.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Headless spell checking of many files in parallel.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "BatchSpellChecker.hpp"
+
+using Lexi::BatchSpellChecker;
+
+//! Append s as a JSON string literal.
+static void AppendJsonString(std::string &output, std::string_view s)
+{
+	output += '"';
+	for (const char kCh : s)
+	{
+		switch (kCh)
+		{
+		case '"':
+			output += "\\\"";
+			break;
+		case '\\':
+			output += "\\\\";
+			break;
+		case '\n':
+			output += "\\n";
+			break;
+		case '\r':
+			output += "\\r";
+			break;
+		case '\t':
+			output += "\\t";
+			break;
+		default:
+			if (static_cast<unsigned char>(kCh) < 0x20)
+			{
+				output += std::format("\\u{:04x}", static_cast<unsigned>(kCh));
+			}
+			else
+			{
+				output += kCh;
+			}
+			break;
+		}
+	}
+
+	output += '"';
+}
+
+double BatchSpellChecker::Stats::GetFilesPerSecond(void) const noexcept
+{
+	return (seconds > 0.0) ? static_cast<double>(numFiles) / seconds : 0.0;
+}
+
+double BatchSpellChecker::Stats::GetMegabytesPerSecond(void) const noexcept
+{
+	return (seconds > 0.0) ? static_cast<double>(numBytes) / (1024.0 * 1024.0) / seconds : 0.0;
+}
+
+BatchSpellChecker::BatchSpellChecker(DictionaryHandle pDictionary, StrongMutableDictionaryPtr pUserDictionary,
+									 ThreadPool &threadPool)
+	: m_pDictionary(std::move(pDictionary)),
+	  m_pUserDictionary(std::move(pUserDictionary)),
+	  m_pThreadPool(&threadPool)
+{
+	LEXI_THROW_IF(!m_pDictionary, "Batch spell checker needs a dictionary!");
+}
+
+BatchSpellChecker::Stats BatchSpellChecker::Run(std::span<const std::filesystem::path> paths,
+												std::ostream &outStream) const
+{
+	std::mutex mutex; // Guards outStream, stats & numPending
+	std::condition_variable doneCondition;
+	std::size_t numPending = paths.size();
+	Stats stats{};
+
+	const auto kStart = std::chrono::steady_clock::now();
+	for (const auto &kPath : paths)
+	{
+		m_pThreadPool->Submit([&, this]()
+		{
+			Stats fileStats{};
+			const std::string kLines = CheckFile(kPath, fileStats);
+
+			std::lock_guard<std::mutex> lockGuard(mutex);
+			outStream << kLines;
+			stats.numFiles += fileStats.numFiles;
+			stats.numFailed += fileStats.numFailed;
+			stats.numBytes += fileStats.numBytes;
+			stats.numMisspellings += fileStats.numMisspellings;
+			if (--numPending == 0)
+			{
+				doneCondition.notify_all();
+			}
+		});
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCondition.wait(lock, [&numPending]() { return numPending == 0; });
+	outStream.flush();
+	stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kStart).count();
+	return stats;
+}
+
+std::vector<std::filesystem::path> BatchSpellChecker::CollectFiles(std::span<const std::string_view> args,
+																   std::istream &inStream)
+{
+	std::vector<std::filesystem::path> paths;
+	for (const auto kArg : args)
+	{
+		if (kArg == "-")
+		{
+			for (std::string line; std::getline(inStream, line);)
+			{
+				if (!line.empty())
+				{
+					paths.emplace_back(line);
+				}
+			}
+		}
+		else if (std::filesystem::is_directory(kArg))
+		{
+			for (const auto &kEntry : std::filesystem::recursive_directory_iterator(
+					 kArg, std::filesystem::directory_options::skip_permission_denied))
+			{
+				if (kEntry.is_regular_file())
+				{
+					paths.push_back(kEntry.path());
+				}
+			}
+		}
+		else
+		{
+			// Missing files are reported as errors by Run().
+			paths.emplace_back(kArg);
+		}
+	}
+
+	return paths;
+}
+
+std::string BatchSpellChecker::CheckFile(const std::filesystem::path &kPath, Stats &stats) const
+{
+	std::string lines;
+	std::string fileName;
+	AppendJsonString(fileName, kPath.string());
+	try
+	{
+		const MemoryMappedFile kFile(kPath);
+		const std::string_view kText = kFile.GetText();
+		// Visitor offsets are 32 bits wide.
+		LEXI_THROW_IF(kText.size() > std::numeric_limits<std::uint32_t>::max(), "File is too large to check!");
+
+		SpellCheckVisitor visitor(m_pDictionary, m_pUserDictionary);
+		visitor.VVisitText(kText);
+		visitor.VVisitRow();
+
+		std::size_t line = 1;
+		std::size_t lineStart = 0;
+		std::size_t scanned = 0;
+		for (const auto &kMisspelling : visitor.GetMisspellings())
+		{
+			// Misspellings are in document order, so newlines are only counted once.
+			const std::size_t kOffset = kMisspelling.range.offset;
+			for (; scanned < kOffset; ++scanned)
+			{
+				if (kText[scanned] == '\n')
+				{
+					++line;
+					lineStart = scanned + 1;
+				}
+			}
+
+			lines += "{\"file\":";
+			lines += fileName;
+			lines += std::format(",\"line\":{},\"column\":{},\"offset\":{},\"length\":{},\"word\":", line,
+								 kOffset - lineStart + 1, kOffset, kMisspelling.range.length);
+			AppendJsonString(lines, kText.substr(kOffset, kMisspelling.range.length));
+			lines += ",\"reason\":";
+			AppendJsonString(lines, SpellCheckVisitor::MissReasonToString(kMisspelling.reason));
+			lines += "}\n";
+		}
+
+		stats.numFiles = 1;
+		stats.numBytes = kText.size();
+		stats.numMisspellings = visitor.GetMisspellings().size();
+	}
+	catch (const Exception &kExcept)
+	{
+		lines += "{\"file\":" + fileName + ",\"error\":";
+		AppendJsonString(lines, kExcept.VWhat());
+		lines += "}\n";
+		stats.numFailed = 1;
+	}
+	catch (const std::exception &kExcept)
+	{
+		lines += "{\"file\":" + fileName + ",\"error\":";
+		AppendJsonString(lines, kExcept.what());
+		lines += "}\n";
+		stats.numFailed = 1;
+	}
+
+	return lines;
+}
+
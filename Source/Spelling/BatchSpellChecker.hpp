@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * @file   BatchSpellChecker.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Headless spell checking of many files in parallel.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_BATCHSPELLCHECKER_HPP
+#define LEXI_BATCHSPELLCHECKER_HPP
+
+namespace Lexi
+{
+	class BatchSpellChecker;
+	LEXI_DECLARE_PTR(BatchSpellChecker);
+
+	/**
+	 * Spell checks files without a document or window (lexi --spellcheck).
+	 *
+	 * Each file is memory-mapped & checked by its own SpellCheckVisitor on
+	 * the thread pool. Results are written as JSON lines as soon as a file
+	 * is done, so files appear in completion order:
+	 *
+	 *   {"file":"a.txt","line":3,"column":7,"offset":120,"length":3,"word":"teh","reason":"Unknown word"}
+	 *   {"file":"b.txt","error":"Couldn't open 'b.txt'!"}
+	 */
+	class BatchSpellChecker final : public INonCopyable
+	{
+	public:
+		//! Totals of a run.
+		struct Stats
+		{
+			std::size_t numFiles; //!< Files checked
+			std::size_t numFailed; //!< Files that could not be read
+			std::size_t numBytes; //!< Bytes checked
+			std::size_t numMisspellings;
+			double seconds; //!< Wall-clock time of the run
+
+			double GetFilesPerSecond(void) const noexcept;
+			double GetMegabytesPerSecond(void) const noexcept;
+		};
+	private:
+		DictionaryHandle m_pDictionary;
+		StrongMutableDictionaryPtr m_pUserDictionary; //!< Optional
+		ThreadPool *m_pThreadPool;
+	public:
+		BatchSpellChecker(DictionaryHandle pDictionary, StrongMutableDictionaryPtr pUserDictionary,
+						  ThreadPool &threadPool);
+
+		//! Check every file, writing JSON lines to outStream; returns when all are done.
+		Stats Run(std::span<const std::filesystem::path> paths, std::ostream &outStream) const;
+		/**
+		 * Expand command line arguments into the files to check.
+		 *
+		 * Directories are searched recursively for regular files, and "-"
+		 * reads one path per line from inStream.
+		 */
+		static std::vector<std::filesystem::path> CollectFiles(std::span<const std::string_view> args,
+															   std::istream &inStream);
+	private:
+		//! Check a single file, returns its JSON lines.
+		std::string CheckFile(const std::filesystem::path &kPath, Stats &stats) const;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_BATCHSPELLCHECKER_HPP */
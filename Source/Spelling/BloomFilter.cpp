@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file   BloomFilter.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Cache-blocked Bloom filter.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "BloomFilter.hpp"
+
+using Lexi::BloomFilter;
+
+BloomFilter::BloomFilter(void)
+	: m_blocks(1)
+{
+}
+
+BloomFilter::BloomFilter(std::size_t numKeys, std::size_t bitsPerKey)
+	: m_blocks(std::max<std::size_t>(1, (numKeys * bitsPerKey + kBLOCK_BITS - 1) / kBLOCK_BITS))
+{
+}
+
+void BloomFilter::Insert(std::string_view key) noexcept
+{
+	const std::uint64_t kHash = HashKey(key);
+	Block &block = m_blocks[GetBlockIndex(kHash)];
+	// Probes come from the low half of the hash (double hashing), the block
+	// index from the high half.
+	std::uint32_t bit = static_cast<std::uint32_t>(kHash);
+	const std::uint32_t kStep = (bit >> kBLOCK_SHIFT) | 1;
+	for (std::size_t probe = 0; probe < kNUM_PROBES; ++probe, bit += kStep)
+	{
+		block.bits[(bit % kBLOCK_BITS) / 64] |= std::uint64_t{ 1 } << (bit % 64);
+	}
+}
+
+bool BloomFilter::MayContain(std::string_view key) const noexcept
+{
+	const std::uint64_t kHash = HashKey(key);
+	const Block &kBlock = m_blocks[GetBlockIndex(kHash)];
+	std::uint32_t bit = static_cast<std::uint32_t>(kHash);
+	const std::uint32_t kStep = (bit >> kBLOCK_SHIFT) | 1;
+	for (std::size_t probe = 0; probe < kNUM_PROBES; ++probe, bit += kStep)
+	{
+		if ((kBlock.bits[(bit % kBLOCK_BITS) / 64] & (std::uint64_t{ 1 } << (bit % 64))) == 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::size_t BloomFilter::GetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_blocks.capacity() * sizeof(Block);
+}
+
+std::uint64_t BloomFilter::HashKey(std::string_view key) noexcept
+{
+	// 64-bit FNV-1a (case-folded) followed by the MurmurHash3 finalizer, so every bit mixes.
+	std::uint64_t hash = 14695981039346656037ULL;
+	CaseFolding::ForEachFoldedByte(key, [&hash](char ch)
+	{
+		hash ^= static_cast<unsigned char>(ch);
+		hash *= 1099511628211ULL;
+	});
+
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+std::size_t BloomFilter::GetBlockIndex(std::uint64_t hash) const noexcept
+{
+	// Multiply-shift maps the high half onto the block count without a modulo.
+	return static_cast<std::size_t>(((hash >> 32) * m_blocks.size()) >> 32);
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * @file   BloomFilter.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Cache-blocked Bloom filter.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_BLOOMFILTER_HPP
+#define LEXI_BLOOMFILTER_HPP
+
+namespace Lexi
+{
+	class BloomFilter;
+	LEXI_DECLARE_PTR(BloomFilter);
+
+	/**
+	 * Cache-blocked Bloom filter over strings.
+	 *
+	 * Every key sets all of its bits inside a single cache line, so a query
+	 * costs at most one cache miss. May report false positives, never false
+	 * negatives. Keys are hashed case-folded (ASCII), matching the
+	 * dictionaries' case-insensitive lookups.
+	 */
+	class BloomFilter
+	{
+	public:
+		static constexpr std::size_t kDEFAULT_BITS_PER_KEY = 12;
+	private:
+		static constexpr std::size_t kBLOCK_WORDS = 8; //!< 64-bit words per block
+		static constexpr std::size_t kBLOCK_BITS = kBLOCK_WORDS * 64; //!< One cache line
+		static constexpr int kBLOCK_SHIFT = std::countr_zero(kBLOCK_BITS); //!< log2(kBLOCK_BITS)
+		static constexpr std::size_t kNUM_PROBES = 7; //!< Bits set per key
+		//! Cache line sized group of bits.
+		struct alignas(64) Block
+		{
+			std::uint64_t bits[kBLOCK_WORDS];
+		};
+
+		std::vector<Block> m_blocks; //!< Filter bits
+	public:
+		BloomFilter(void);
+		//! Size the filter for a number of keys.
+		explicit BloomFilter(std::size_t numKeys, std::size_t bitsPerKey = kDEFAULT_BITS_PER_KEY);
+
+		void Insert(std::string_view key) noexcept;
+		//! Returns false only if key was never inserted.
+		bool MayContain(std::string_view key) const noexcept;
+		// Accessors:
+		std::size_t GetMemoryUsage(void) const noexcept;
+	private:
+		static std::uint64_t HashKey(std::string_view key) noexcept;
+		std::size_t GetBlockIndex(std::uint64_t hash) const noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_BLOOMFILTER_HPP */
@@ -0,0 +1,307 @@
+/*******************************************************************************
+ * @file   CaseFolding.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  ASCII case folding & capitalization rules.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_CASEFOLDING_HPP
+#define LEXI_CASEFOLDING_HPP
+
+namespace Lexi
+{
+	//! Capitalization of a word, judged by its letters only.
+	enum struct WordCase : std::uint8_t
+	{
+		kLower, //!< "apple" (also words without letters)
+		kCapitalized, //!< "Apple"
+		kUpper, //!< "APPLE" (also single capital letters)
+		kMixed //!< "McDonald", "iPhone"
+	};
+
+	/**
+	 * Case-insensitive matching shared by the dictionaries.
+	 *
+	 * Dictionaries match words as written in the text: a lowercase entry
+	 * accepts its lowercase, capitalized & all caps forms, other entries
+	 * accept their exact spelling & all caps ("Aarhus" accepts "AARHUS" but
+	 * not "aarhus").
+	 *
+	 * Words are UTF-8: ASCII takes an inline fast path, other code points are
+	 * case mapped with Unicode::ToLower() & Unicode::ToUpper(). Case mapping
+	 * never changes the length of a word, so it can be done in place.
+	 */
+	class CaseFolding
+	{
+	public:
+		static char FoldChar(char ch) noexcept;
+		static char UpperChar(char ch) noexcept;
+		static bool IsUpperChar(char ch) noexcept;
+		static WordCase GetWordCase(std::string_view word) noexcept;
+		//! Compare two words ignoring case.
+		static bool EqualsFolded(std::string_view first, std::string_view second) noexcept;
+		//! Write the lowercase form of word to pOutput (word.size() bytes, may alias word).
+		static void FoldWord(std::string_view word, char *pOutput) noexcept;
+		//! Write the all caps form of word to pOutput (word.size() bytes, may alias word).
+		static void UpperWord(std::string_view word, char *pOutput) noexcept;
+		//! Write word to pOutput with its first letter uppercased (word.size() bytes, may alias word).
+		static void CapitalizeWord(std::string_view word, char *pOutput) noexcept;
+		//! Invoke func(char) for every byte of the lowercase form of word, without storing it.
+		template <typename Func>
+		static void ForEachFoldedByte(std::string_view word, Func &&func);
+		//! Determine whether or not word is an acceptable spelling of a dictionary entry it folds equal to.
+		static bool IsAccepted(std::string_view entry, std::string_view word) noexcept;
+		static bool IsAccepted(WordCase entryCase, WordCase wordCase) noexcept;
+	private:
+		//! Invoke func(Unicode::CodePoint, offset) for every code point, returns early if func returns false.
+		template <typename Func>
+		static void ForEachCodePoint(std::string_view word, Func &&func);
+		template <typename MapFunc>
+		static void MapWord(std::string_view word, char *pOutput, MapFunc &&mapFunc) noexcept;
+	};
+
+	inline char CaseFolding::FoldChar(char ch) noexcept
+	{
+		return IsUpperChar(ch) ? static_cast<char>(ch | 0x20) : ch;
+	}
+
+	inline char CaseFolding::UpperChar(char ch) noexcept
+	{
+		return (static_cast<unsigned char>(ch - 'a') < 26) ? static_cast<char>(ch & ~0x20) : ch;
+	}
+
+	inline bool CaseFolding::IsUpperChar(char ch) noexcept
+	{
+		return static_cast<unsigned char>(ch - 'A') < 26;
+	}
+
+	template <typename Func>
+	inline void CaseFolding::ForEachCodePoint(std::string_view word, Func &&func)
+	{
+		for (std::size_t offset = 0; offset < word.size(); )
+		{
+			const char kCh = word[offset];
+			const Unicode::CodePoint kCodePoint = Unicode::IsAscii(kCh)
+				? Unicode::CodePoint{ static_cast<char32_t>(kCh), 1 }
+				: Unicode::Decode(word.substr(offset));
+			if (!func(kCodePoint, offset))
+			{
+				return;
+			}
+
+			offset += kCodePoint.length;
+		}
+	}
+
+	template <typename MapFunc>
+	inline void CaseFolding::MapWord(std::string_view word, char *pOutput, MapFunc &&mapFunc) noexcept
+	{
+		ForEachCodePoint(word, [&](const Unicode::CodePoint &kCodePoint, std::size_t offset)
+		{
+			if (kCodePoint.length == 1)
+			{
+				// ASCII or an invalid byte, which is copied as is.
+				pOutput[offset] = (kCodePoint.value < 0x80) ? static_cast<char>(mapFunc(kCodePoint.value)) : word[offset];
+			}
+			else
+			{
+				Unicode::Encode(mapFunc(kCodePoint.value), pOutput + offset);
+			}
+
+			return true;
+		});
+	}
+
+	inline WordCase CaseFolding::GetWordCase(std::string_view word) noexcept
+	{
+		std::size_t numLetters = 0;
+		std::size_t numUpper = 0;
+		bool bFirstUpper = false;
+		const auto kCountLetter = [&](bool bUpper)
+		{
+			bFirstUpper = (numLetters == 0) ? bUpper : bFirstUpper;
+			numUpper += bUpper;
+			++numLetters;
+		};
+
+		for (std::size_t offset = 0; offset < word.size(); )
+		{
+			const char kCh = word[offset];
+			if (Unicode::IsAscii(kCh))
+			{
+				if (WordTokenizer::IsWordChar(kCh))
+				{
+					kCountLetter(IsUpperChar(kCh));
+				}
+
+				++offset;
+				continue;
+			}
+
+			// Uncased letters (CJK, "ß") count neither way.
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(word.substr(offset));
+			if (Unicode::IsCased(kCodePoint.value))
+			{
+				kCountLetter(Unicode::IsUpper(kCodePoint.value));
+			}
+
+			offset += kCodePoint.length;
+		}
+
+		if (numUpper == 0)
+		{
+			return WordCase::kLower;
+		}
+		else if (numUpper == numLetters)
+		{
+			return WordCase::kUpper;
+		}
+		else if (bFirstUpper && numUpper == 1)
+		{
+			return WordCase::kCapitalized;
+		}
+
+		return WordCase::kMixed;
+	}
+
+	inline bool CaseFolding::EqualsFolded(std::string_view first, std::string_view second) noexcept
+	{
+		if (first.size() != second.size())
+		{
+			return false;
+		}
+
+		for (std::size_t offset = 0; offset < first.size(); )
+		{
+			const char kFirst = first[offset];
+			const char kSecond = second[offset];
+			if (Unicode::IsAscii(kFirst) && Unicode::IsAscii(kSecond))
+			{
+				if (FoldChar(kFirst) != FoldChar(kSecond))
+				{
+					return false;
+				}
+
+				++offset;
+				continue;
+			}
+
+			const Unicode::CodePoint kFirstCodePoint = Unicode::Decode(first.substr(offset));
+			const Unicode::CodePoint kSecondCodePoint = Unicode::Decode(second.substr(offset));
+			if (kFirstCodePoint.length != kSecondCodePoint.length)
+			{
+				return false;
+			}
+			else if (kFirstCodePoint.length == 1)
+			{
+				// Invalid bytes only match themselves.
+				if (kFirst != kSecond)
+				{
+					return false;
+				}
+			}
+			else if (Unicode::ToLower(kFirstCodePoint.value) != Unicode::ToLower(kSecondCodePoint.value))
+			{
+				return false;
+			}
+
+			offset += kFirstCodePoint.length;
+		}
+
+		return true;
+	}
+
+	inline void CaseFolding::FoldWord(std::string_view word, char *pOutput) noexcept
+	{
+		MapWord(word, pOutput, Unicode::ToLower);
+	}
+
+	inline void CaseFolding::UpperWord(std::string_view word, char *pOutput) noexcept
+	{
+		MapWord(word, pOutput, Unicode::ToUpper);
+	}
+
+	inline void CaseFolding::CapitalizeWord(std::string_view word, char *pOutput) noexcept
+	{
+		if (pOutput != word.data())
+		{
+			std::ranges::copy(word, pOutput);
+		}
+
+		ForEachCodePoint(word, [&](const Unicode::CodePoint &kCodePoint, std::size_t offset)
+		{
+			if (!Unicode::IsLetter(kCodePoint.value))
+			{
+				return true;
+			}
+
+			Unicode::Encode(Unicode::ToUpper(kCodePoint.value), pOutput + offset);
+			return false;
+		});
+	}
+
+	template <typename Func>
+	inline void CaseFolding::ForEachFoldedByte(std::string_view word, Func &&func)
+	{
+		for (std::size_t offset = 0; offset < word.size(); )
+		{
+			const char kCh = word[offset];
+			if (Unicode::IsAscii(kCh))
+			{
+				func(FoldChar(kCh));
+				++offset;
+				continue;
+			}
+
+			const Unicode::CodePoint kCodePoint = Unicode::Decode(word.substr(offset));
+			if (kCodePoint.length == 1)
+			{
+				func(kCh);
+			}
+			else
+			{
+				char folded[Unicode::kMAX_SEQUENCE_LENGTH];
+				const std::size_t kLength = Unicode::Encode(Unicode::ToLower(kCodePoint.value), folded);
+				std::for_each_n(folded, kLength, func);
+			}
+
+			offset += kCodePoint.length;
+		}
+	}
+
+	inline bool CaseFolding::IsAccepted(std::string_view entry, std::string_view word) noexcept
+	{
+		return entry == word || IsAccepted(GetWordCase(entry), GetWordCase(word));
+	}
+
+	inline bool CaseFolding::IsAccepted(WordCase entryCase, WordCase wordCase) noexcept
+	{
+		// Besides the exact spelling: all caps always, capitalized only for lowercase entries.
+		return wordCase == WordCase::kUpper || (entryCase == WordCase::kLower && wordCase != WordCase::kMixed);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_CASEFOLDING_HPP */
@@ -0,0 +1,387 @@
+/*******************************************************************************
+ * @file   DawgDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Minimized directed acyclic word graph.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "DawgDictionary.hpp"
+
+using Lexi::DawgDictionary;
+
+namespace
+{
+	//! Mutable node used while building the graph.
+	struct BuildNode
+	{
+		std::vector<std::pair<unsigned char, std::uint32_t>> edges;
+		bool bFinal = false;
+	};
+	//! Edge waiting to be minimized (parent -label-> child).
+	struct UncheckedEdge
+	{
+		std::uint32_t parent;
+		unsigned char label;
+		std::uint32_t child;
+	};
+	//! Key identifying nodes with the same right language.
+	std::string GetSignature(const BuildNode &kNode)
+	{
+		std::string signature(1, kNode.bFinal ? '1' : '0');
+		for (const auto &[kLabel, kChild] : kNode.edges)
+		{
+			signature += static_cast<char>(kLabel);
+			signature.append(reinterpret_cast<const char *>(&kChild), sizeof(kChild));
+		}
+
+		return signature;
+	}
+} // End anonymous namespace
+
+DawgDictionary::DawgDictionary(void)
+	: m_edges{},
+	  m_size(0)
+{
+}
+
+DawgDictionary::DawgDictionary(const std::filesystem::path &kPath)
+	: DawgDictionary()
+{
+	// Reuse the hash dictionary loader so both word list formats are accepted.
+	const HashDictionary kSource(kPath);
+	std::vector<std::string> words;
+	words.reserve(kSource.VGetSize());
+	kSource.VForEachWord([&words](std::string_view word) { words.emplace_back(word); });
+	Build(std::move(words));
+}
+
+DawgDictionary::DawgDictionary(std::vector<std::string> words)
+	: DawgDictionary()
+{
+	Build(std::move(words));
+}
+
+void DawgDictionary::ForEachWithPrefix(std::string_view prefix, const WordCallback &kCallback) const
+{
+	if (m_edges.empty())
+	{
+		return;
+	}
+
+	std::string word(prefix);
+	std::size_t node = 0;
+	for (std::size_t index = 0; index < prefix.size(); ++index)
+	{
+		const auto kEdge = (index == 0 || node != kNO_CHILD) ? FindEdge(node, prefix[index]) : std::nullopt;
+		if (!kEdge)
+		{
+			return;
+		}
+
+		const bool kbLastChar = (index + 1 == prefix.size());
+		if (kbLastChar && IsFinal(m_edges[*kEdge]) && !kCallback(word))
+		{
+			return;
+		}
+
+		node = GetChild(m_edges[*kEdge]);
+	}
+
+	if (prefix.empty() || node != kNO_CHILD)
+	{
+		ForEachFrom(node, word, kCallback);
+	}
+}
+
+bool DawgDictionary::VContains(std::string_view word) const noexcept
+{
+	if (word.empty() || m_edges.empty())
+	{
+		return false;
+	}
+	// Words are stored as listed, so try the spellings the CaseFolding rules accept.
+	switch (CaseFolding::GetWordCase(word))
+	{
+	case WordCase::kCapitalized:
+		return ContainsSpelling(word, false) || ContainsSpelling(word, true);
+	case WordCase::kUpper:
+		return ContainsAnyCase(0, word);
+	default:
+		return ContainsSpelling(word, false);
+	}
+}
+
+void DawgDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	ForEachWithPrefix("", [&kFunc](std::string_view word)
+	{
+		kFunc(word);
+		return true;
+	});
+}
+
+std::size_t DawgDictionary::VGetSize(void) const noexcept
+{
+	return m_size;
+}
+
+std::size_t DawgDictionary::VGetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_edges.capacity() * sizeof(Edge);
+}
+
+std::size_t DawgDictionary::GetNumEdges(void) const noexcept
+{
+	return m_edges.size();
+}
+
+double DawgDictionary::GetBytesPerWord(void) const noexcept
+{
+	return (m_size > 0) ? (static_cast<double>(VGetMemoryUsage()) / static_cast<double>(m_size)) : 0.0;
+}
+
+bool DawgDictionary::ContainsSpelling(std::string_view word, bool bFolded) const noexcept
+{
+	std::size_t node = 0;
+	std::size_t numLabels = 0;
+	bool bFound = true;
+	bool bFinal = false;
+	const auto kFollow = [&](char label)
+	{
+		if (!bFound || (numLabels++ > 0 && node == kNO_CHILD))
+		{
+			bFound = false;
+			return;
+		}
+
+		const auto kEdge = FindEdge(node, label);
+		if (!kEdge)
+		{
+			bFound = false;
+			return;
+		}
+
+		bFinal = IsFinal(m_edges[*kEdge]);
+		node = GetChild(m_edges[*kEdge]);
+	};
+
+	if (bFolded)
+	{
+		CaseFolding::ForEachFoldedByte(word, kFollow);
+	}
+	else
+	{
+		std::ranges::for_each(word, kFollow);
+	}
+
+	return bFound && bFinal;
+}
+
+bool DawgDictionary::ContainsAnyCase(std::size_t node, std::string_view word) const noexcept
+{
+	// Both cases of the first character, one label per UTF-8 byte.
+	char labels[2][Unicode::kMAX_SEQUENCE_LENGTH];
+	const Unicode::CodePoint kCodePoint = Unicode::Decode(word);
+	const std::size_t kLength = kCodePoint.length;
+	if (kLength == 1)
+	{
+		labels[0][0] = CaseFolding::FoldChar(word.front());
+		labels[1][0] = CaseFolding::UpperChar(word.front());
+	}
+	else
+	{
+		Unicode::Encode(Unicode::ToLower(kCodePoint.value), labels[0]);
+		Unicode::Encode(Unicode::ToUpper(kCodePoint.value), labels[1]);
+	}
+
+	const std::size_t kNumVariants = std::equal(labels[0], labels[0] + kLength, labels[1]) ? 1 : 2; // Only letters have two paths
+	const std::string_view kRest = word.substr(kLength);
+	for (std::size_t variant = 0; variant < kNumVariants; ++variant)
+	{
+		std::size_t child = node;
+		bool bFinal = false;
+		std::size_t index = 0;
+		for (; index < kLength; ++index)
+		{
+			const auto kEdge = (index == 0 || child != kNO_CHILD) ? FindEdge(child, labels[variant][index]) : std::nullopt;
+			if (!kEdge)
+			{
+				break;
+			}
+
+			bFinal = IsFinal(m_edges[*kEdge]);
+			child = GetChild(m_edges[*kEdge]);
+		}
+
+		if (index == kLength && (kRest.empty() ? bFinal : (child != kNO_CHILD && ContainsAnyCase(child, kRest))))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void DawgDictionary::Build(std::vector<std::string> words)
+{
+	// Incremental construction of a minimal automaton from sorted input
+	// (Daciuk, Mihov, Watson & Watson, 2000).
+	std::ranges::sort(words);
+	const auto kDuplicates = std::ranges::unique(words);
+	words.erase(kDuplicates.begin(), kDuplicates.end());
+
+	std::vector<BuildNode> nodes(1);
+	std::unordered_map<std::string, std::uint32_t> registry;
+	std::vector<UncheckedEdge> unchecked;
+	auto minimize = [&](std::size_t downTo)
+	{
+		while (unchecked.size() > downTo)
+		{
+			const UncheckedEdge kEdge = unchecked.back();
+			unchecked.pop_back();
+
+			auto [iter, bInserted] = registry.try_emplace(GetSignature(nodes[kEdge.child]), kEdge.child);
+			if (!bInserted)
+			{
+				// An equivalent node exists; the child was the last edge added to its parent.
+				nodes[kEdge.parent].edges.back().second = iter->second;
+			}
+		}
+	};
+
+	std::string_view prevWord;
+	m_size = 0;
+	for (const auto &kWord : words)
+	{
+		if (kWord.empty())
+		{
+			continue;
+		}
+
+		const auto kMismatch = std::ranges::mismatch(kWord, prevWord);
+		const std::size_t kCommonLen = static_cast<std::size_t>(kMismatch.in1 - kWord.begin());
+		minimize(kCommonLen);
+
+		std::uint32_t node = unchecked.empty() ? 0 : unchecked.back().child;
+		for (std::size_t index = kCommonLen; index < kWord.size(); ++index)
+		{
+			const auto kChild = static_cast<std::uint32_t>(nodes.size());
+			const auto kLabel = static_cast<unsigned char>(kWord[index]);
+			nodes.emplace_back();
+			nodes[node].edges.emplace_back(kLabel, kChild);
+			unchecked.push_back(UncheckedEdge{ node, kLabel, kChild });
+			node = kChild;
+		}
+
+		nodes[node].bFinal = true;
+		prevWord = kWord;
+		++m_size;
+	}
+	minimize(0);
+	// Lay nodes out breadth-first, giving each node with edges a run in the array.
+	constexpr std::size_t kUNASSIGNED = std::numeric_limits<std::size_t>::max();
+	std::vector<std::size_t> offsets(nodes.size(), kUNASSIGNED);
+	std::vector<std::uint32_t> order{ 0 };
+	offsets[0] = 0;
+	std::size_t numEdges = nodes[0].edges.size();
+	for (std::size_t index = 0; index < order.size(); ++index)
+	{
+		for (const auto &[kLabel, kChild] : nodes[order[index]].edges)
+		{
+			if (!nodes[kChild].edges.empty() && offsets[kChild] == kUNASSIGNED)
+			{
+				offsets[kChild] = numEdges;
+				numEdges += nodes[kChild].edges.size();
+				order.push_back(kChild);
+			}
+		}
+	}
+	LEXI_THROW_IF(numEdges > kMAX_CHILD, "Word graph is too large!");
+
+	m_edges.assign(numEdges, Edge{});
+	for (const std::uint32_t kNode : order)
+	{
+		const auto &kEdges = nodes[kNode].edges;
+		for (std::size_t index = 0; index < kEdges.size(); ++index)
+		{
+			const auto &[kLabel, kChild] = kEdges[index];
+			const std::size_t kChildOffset = nodes[kChild].edges.empty() ? kNO_CHILD : offsets[kChild];
+			Edge edge = static_cast<Edge>(kChildOffset << kCHILD_SHIFT) | kLabel;
+			edge |= nodes[kChild].bFinal ? kFINAL_BIT : 0;
+			edge |= (index + 1 == kEdges.size()) ? kLAST_BIT : 0;
+			m_edges[offsets[kNode] + index] = edge;
+		}
+	}
+	m_edges.shrink_to_fit();
+}
+
+std::optional<std::size_t> DawgDictionary::FindEdge(std::size_t node, unsigned char label) const noexcept
+{
+	if (m_edges.empty())
+	{
+		return std::nullopt;
+	}
+	// Edges are sorted by label, so stop once the label has been passed.
+	for (std::size_t index = node; ; ++index)
+	{
+		const Edge kEdge = m_edges[index];
+		if (GetLabel(kEdge) == label)
+		{
+			return index;
+		}
+
+		if (GetLabel(kEdge) > label || IsLast(kEdge))
+		{
+			return std::nullopt;
+		}
+	}
+}
+
+bool DawgDictionary::ForEachFrom(std::size_t node, std::string &word, const WordCallback &kCallback) const
+{
+	for (std::size_t index = node; ; ++index)
+	{
+		const Edge kEdge = m_edges[index];
+		word.push_back(static_cast<char>(GetLabel(kEdge)));
+
+		if (IsFinal(kEdge) && !kCallback(word))
+		{
+			return false;
+		}
+
+		if (GetChild(kEdge) != kNO_CHILD && !ForEachFrom(GetChild(kEdge), word, kCallback))
+		{
+			return false;
+		}
+
+		word.pop_back();
+		if (IsLast(kEdge))
+		{
+			return true;
+		}
+	}
+}
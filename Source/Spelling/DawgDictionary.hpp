@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * @file   DawgDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Minimized directed acyclic word graph.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_DAWGDICTIONARY_HPP
+#define LEXI_DAWGDICTIONARY_HPP
+
+namespace Lexi
+{
+	class DawgDictionary;
+	LEXI_DECLARE_PTR(DawgDictionary);
+
+	/**
+	 * Minimized directed acyclic word graph (DAWG).
+	 *
+	 * Shared prefixes & suffixes are stored once, and the graph is flattened
+	 * into a single array of 32-bit edges. The edges leaving a node are stored
+	 * next to each other, so a node is just the index of its first edge.
+	 */
+	class DawgDictionary final : public IDictionary
+	{
+	public:
+		using Edge = std::uint32_t;
+		using WordCallback = std::function<bool (std::string_view word)>;
+	private:
+		// Edge layout: | child index (22) | last (1) | final (1) | label (8) |
+		static constexpr Edge kLABEL_MASK = 0xFFu;
+		static constexpr Edge kFINAL_BIT = 1u << 8;
+		static constexpr Edge kLAST_BIT = 1u << 9;
+		static constexpr unsigned kCHILD_SHIFT = 10;
+		static constexpr Edge kMAX_CHILD = (1u << (32 - kCHILD_SHIFT)) - 1;
+		static constexpr Edge kNO_CHILD = 0; //!< The root is never a child
+
+		std::vector<Edge> m_edges; //!< Flattened edge array, root edges first
+		std::size_t m_size; //!< Number of words stored
+	public:
+		DawgDictionary(void);
+		//! Build from a word list containing one word per line.
+		explicit DawgDictionary(const std::filesystem::path &kPath);
+		//! Build from words in any order (duplicates are ignored).
+		explicit DawgDictionary(std::vector<std::string> words);
+
+		/**
+		 * Visit every word that starts with prefix in lexicographic order.
+		 *
+		 * Stops early once callback returns false.
+		 */
+		void ForEachWithPrefix(std::string_view prefix, const WordCallback &kCallback) const;
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const noexcept override;
+		//! Words are visited in lexicographic order.
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		// Accessors:
+		std::size_t GetNumEdges(void) const noexcept;
+		//! Retrieve the average number of bytes used per word.
+		double GetBytesPerWord(void) const noexcept;
+	private:
+		void Build(std::vector<std::string> words);
+		//! Find the edge leaving node with label, returns nullopt if there is none.
+		std::optional<std::size_t> FindEdge(std::size_t node, unsigned char label) const noexcept;
+		bool ForEachFrom(std::size_t node, std::string &word, const WordCallback &kCallback) const;
+		//! Follow the word's path from the root, optionally lowercasing it on the way.
+		bool ContainsSpelling(std::string_view word, bool bFolded) const noexcept;
+		//! Follow both cases of every letter (for all caps words).
+		bool ContainsAnyCase(std::size_t node, std::string_view word) const noexcept;
+
+		static constexpr unsigned char GetLabel(Edge edge) noexcept { return static_cast<unsigned char>(edge & kLABEL_MASK); }
+		static constexpr bool IsFinal(Edge edge) noexcept { return (edge & kFINAL_BIT) != 0; }
+		static constexpr bool IsLast(Edge edge) noexcept { return (edge & kLAST_BIT) != 0; }
+		static constexpr std::size_t GetChild(Edge edge) noexcept { return edge >> kCHILD_SHIFT; }
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_DAWGDICTIONARY_HPP */
@@ -0,0 +1,326 @@
+/*******************************************************************************
+ * @file   DictionaryRegistry.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Process-wide cache of loaded dictionaries keyed by path.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "DictionaryRegistry.hpp"
+
+using Lexi::DictionaryRegistry;
+// Declare/initialize static class members:
+Lexi::UniqueDictionaryRegistryPtr DictionaryRegistry::s_pInstance;
+std::mutex DictionaryRegistry::s_mutex;
+
+DictionaryRegistry::DictionaryRegistry(void)
+	: m_mutex{},
+	  m_dictionaries{},
+	  m_loading{},
+	  m_pUserDictionary{},
+	  m_pWatcher{},
+	  m_stats{}
+{
+}
+
+Lexi::DictionaryHandle DictionaryRegistry::Acquire(const std::filesystem::path &kPath,
+												   Config::DictionaryStorage storage, bool bFilter)
+{
+	const std::string kKey = MakeKey(kPath, storage, bFilter);
+	std::promise<DictionaryHandle> promise;
+	PendingDictionary pending;
+	if (Reserve(kKey, promise, pending))
+	{
+		Load(kKey, kPath, storage, bFilter, promise);
+	}
+	// Rethrows the load error, also for requests that waited on another thread's load.
+	return pending.get();
+}
+
+Lexi::DictionaryHandle DictionaryRegistry::AcquireConfigured(void)
+{
+	const Config::User &kUser = Config::Get().GetUser();
+	return Acquire(kUser.wordDictPath, kUser.wordDictStorage, kUser.bWordDictFilter);
+}
+
+Lexi::PendingDictionary DictionaryRegistry::AcquireAsync(ThreadPool &threadPool, const std::filesystem::path &kPath,
+														 Config::DictionaryStorage storage, bool bFilter)
+{
+	std::string key = MakeKey(kPath, storage, bFilter);
+	auto pPromise = std::make_shared<std::promise<DictionaryHandle>>();
+	PendingDictionary pending;
+	if (Reserve(key, *pPromise, pending))
+	{
+		threadPool.Submit([this, key = std::move(key), kPath, storage, bFilter, pPromise]()
+		{
+			Load(key, kPath, storage, bFilter, *pPromise);
+		});
+	}
+
+	return pending;
+}
+
+Lexi::PendingDictionary DictionaryRegistry::AcquireConfiguredAsync(ThreadPool &threadPool)
+{
+	const Config::User &kUser = Config::Get().GetUser();
+	return AcquireAsync(threadPool, kUser.wordDictPath, kUser.wordDictStorage, kUser.bWordDictFilter);
+}
+
+Lexi::StrongMutableDictionaryPtr DictionaryRegistry::GetUserDictionary(void)
+{
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	if (!m_pUserDictionary)
+	{
+		m_pUserDictionary = std::make_shared<MutableDictionary>();
+
+		const std::string &kPath = Config::Get().GetUser().userDictPath;
+		if (!kPath.empty() && m_pUserDictionary->Load(kPath))
+		{
+			LEXI_LOG("Loaded {} user dictionary word(s) from '{}'.", m_pUserDictionary->VGetSize(), kPath);
+		}
+	}
+
+	return m_pUserDictionary;
+}
+
+void DictionaryRegistry::SaveUserDictionary(void) const
+{
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	const std::string &kPath = Config::Get().GetUser().userDictPath;
+	if (m_pUserDictionary && !kPath.empty())
+	{
+		m_pUserDictionary->Save(kPath);
+	}
+}
+
+bool DictionaryRegistry::EnableHotReload(void)
+{
+	if (!FileWatcher::IsSupported())
+	{
+		LEXI_LOG("Dictionary hot reloading is unsupported on this platform.");
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	if (!m_pWatcher)
+	{
+		m_pWatcher = std::make_unique<FileWatcher>([this](const std::filesystem::path &kPath) { OnFileChanged(kPath); });
+		for (const auto &[kKey, kEntry] : m_dictionaries)
+		{
+			if (!kEntry.pDictionary.expired())
+			{
+				for (const auto &kSourcePath : GetSourceFiles(kEntry.path))
+				{
+					m_pWatcher->Watch(kSourcePath);
+				}
+			}
+		}
+
+		if (const std::string &kUserPath = Config::Get().GetUser().userDictPath; !kUserPath.empty())
+		{
+			m_pWatcher->Watch(kUserPath);
+		}
+	}
+
+	return true;
+}
+
+void DictionaryRegistry::DisableHotReload(void)
+{
+	UniqueFileWatcherPtr pWatcher;
+	{
+		std::lock_guard<std::mutex> lockGuard(m_mutex);
+		pWatcher = std::move(m_pWatcher);
+	}
+	// Joined outside the lock, its callback takes the lock too.
+	pWatcher.reset();
+}
+
+DictionaryRegistry &DictionaryRegistry::Get(void)
+{
+	// Uses RAII to unlock after destruction.
+	std::lock_guard<std::mutex> lockGuard(s_mutex);
+	if (!s_pInstance)
+	{
+		s_pInstance = std::unique_ptr<DictionaryRegistry>(LEXI_NEW DictionaryRegistry);
+	}
+
+	return *s_pInstance.get();
+}
+
+std::size_t DictionaryRegistry::GetNumLoaded(void) const
+{
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	return static_cast<std::size_t>(std::ranges::count_if(m_dictionaries, [](const auto &kPair)
+	{
+		return !kPair.second.pDictionary.expired();
+	}));
+}
+
+DictionaryRegistry::Stats DictionaryRegistry::GetStats(void) const
+{
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	return m_stats;
+}
+
+bool DictionaryRegistry::Reserve(const std::string &kKey, std::promise<DictionaryHandle> &promise,
+								 PendingDictionary &pending)
+{
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	++m_stats.numAcquires;
+	if (auto iter = m_dictionaries.find(kKey); iter != m_dictionaries.end())
+	{
+		if (DictionaryHandle pDictionary = iter->second.pDictionary.lock())
+		{
+			promise.set_value(std::move(pDictionary));
+			pending = promise.get_future().share();
+			return false;
+		}
+	}
+
+	if (auto iter = m_loading.find(kKey); iter != m_loading.end())
+	{
+		// Share the load in progress instead of loading twice.
+		pending = iter->second;
+		return false;
+	}
+
+	pending = promise.get_future().share();
+	m_loading.emplace(kKey, pending);
+	return true;
+}
+
+void DictionaryRegistry::Load(const std::string &kKey, const std::filesystem::path &kPath,
+							  Config::DictionaryStorage storage, bool bFilter, std::promise<DictionaryHandle> &promise)
+{
+	try
+	{
+		const auto kStart = std::chrono::steady_clock::now();
+		auto pDictionary = std::make_shared<ReloadableDictionary>(LoadDictionary(kPath, storage, bFilter));
+		LEXI_LOG("Dictionary registry loaded '{}' ({} words, {} bytes) in {:.1f} ms.", kPath.string(),
+				 pDictionary->VGetSize(), pDictionary->VGetMemoryUsage(),
+				 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - kStart).count());
+		{
+			std::lock_guard<std::mutex> lockGuard(m_mutex);
+			// Forget dictionaries that have been released since the last load.
+			std::erase_if(m_dictionaries, [](const auto &kPair)
+			{
+				return kPair.second.pDictionary.expired();
+			});
+			const auto kAbsolutePath = std::filesystem::absolute(kPath).lexically_normal();
+			m_dictionaries[kKey] = Entry{ pDictionary, kAbsolutePath, storage, bFilter };
+			m_loading.erase(kKey);
+			++m_stats.numLoads;
+			if (m_pWatcher)
+			{
+				for (const auto &kSourcePath : GetSourceFiles(kAbsolutePath))
+				{
+					m_pWatcher->Watch(kSourcePath);
+				}
+			}
+		}
+
+		promise.set_value(std::move(pDictionary));
+	}
+	catch (...)
+	{
+		{
+			std::lock_guard<std::mutex> lockGuard(m_mutex);
+			m_loading.erase(kKey);
+		}
+
+		promise.set_exception(std::current_exception());
+	}
+}
+
+void DictionaryRegistry::OnFileChanged(const std::filesystem::path &kPath)
+{
+	std::vector<std::pair<StrongReloadableDictionaryPtr, Entry>> reloads;
+	StrongMutableDictionaryPtr pUserDictionary;
+	{
+		std::lock_guard<std::mutex> lockGuard(m_mutex);
+		for (const auto &[kKey, kEntry] : m_dictionaries)
+		{
+			const auto kSourceFiles = GetSourceFiles(kEntry.path);
+			if (auto pDictionary = kEntry.pDictionary.lock();
+				pDictionary && std::ranges::find(kSourceFiles, kPath) != kSourceFiles.end())
+			{
+				reloads.emplace_back(std::move(pDictionary), kEntry);
+			}
+		}
+
+		const std::string &kUserPath = Config::Get().GetUser().userDictPath;
+		if (!kUserPath.empty() && std::filesystem::absolute(kUserPath).lexically_normal() == kPath)
+		{
+			pUserDictionary = m_pUserDictionary;
+		}
+	}
+	// Build the new versions without the lock, lookups keep using the old ones meanwhile.
+	for (auto &[pDictionary, kEntry] : reloads)
+	{
+		const auto kStart = std::chrono::steady_clock::now();
+		pDictionary->Publish(LoadDictionary(kEntry.path, kEntry.storage, kEntry.bFilter));
+		LEXI_LOG("Dictionary registry reloaded '{}' (version {}, {} words) in {:.1f} ms.", kPath.string(),
+				 pDictionary->GetVersion(), pDictionary->VGetSize(),
+				 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - kStart).count());
+
+		std::lock_guard<std::mutex> lockGuard(m_mutex);
+		++m_stats.numReloads;
+	}
+
+	// Replaced rather than merged, so words deleted from the file stop being accepted.
+	if (pUserDictionary && pUserDictionary->Reload(kPath))
+	{
+		LEXI_LOG("Reloaded the changed user dictionary ({} words).", pUserDictionary->VGetSize());
+	}
+}
+
+std::vector<std::filesystem::path> DictionaryRegistry::GetSourceFiles(const std::filesystem::path &kPath)
+{
+	if (!AffixDictionary::IsAffixFile(kPath))
+	{
+		return { kPath };
+	}
+
+	// AffixDictionary reads the rules & the stems from siblings of either file.
+	return { std::filesystem::path(kPath).replace_extension(".dic"), std::filesystem::path(kPath).replace_extension(".aff") };
+}
+
+std::string DictionaryRegistry::MakeKey(const std::filesystem::path &kPath, Config::DictionaryStorage storage,
+										bool bFilter)
+{
+	// Different spellings of the same path share an entry.
+	std::error_code error;
+	std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(kPath, error);
+	if (error)
+	{
+		canonicalPath = kPath;
+	}
+
+	return std::format("{}|{}|{}", canonicalPath.string(), Config::DictionaryStorageToString(storage),
+					   bFilter ? "filtered" : "plain");
+}
+
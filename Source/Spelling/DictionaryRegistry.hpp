@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file   DictionaryRegistry.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Process-wide cache of loaded dictionaries keyed by path.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_DICTIONARYREGISTRY_HPP
+#define LEXI_DICTIONARYREGISTRY_HPP
+
+namespace Lexi
+{
+	class DictionaryRegistry;
+	LEXI_DECLARE_PTR(DictionaryRegistry);
+
+	/**
+	 * Process-wide registry of loaded dictionaries singleton.
+	 *
+	 * Dictionaries are keyed by path (& storage options) and handed out as
+	 * shared, read-only handles, so every visitor checking against the same
+	 * word list shares one instance. The registry only keeps weak references:
+	 * a dictionary is unloaded once the last handle is released.
+	 *
+	 * With hot reloading enabled, dictionary files are watched; a changed
+	 * file is loaded again on the watcher thread and published to every
+	 * handle (see ReloadableDictionary) without interrupting lookups.
+	 */
+	class DictionaryRegistry final : public INonCopyable, public INonMoveable
+	{
+	public:
+		//! Registry counters.
+		struct Stats
+		{
+			std::uint64_t numAcquires; //!< Calls to Acquire()
+			std::uint64_t numLoads; //!< Acquisitions that had to load the file
+			std::uint64_t numReloads; //!< Versions published after a file changed
+		};
+	private:
+		//! Loaded dictionary & how to load it again.
+		struct Entry
+		{
+			std::weak_ptr<ReloadableDictionary> pDictionary;
+			std::filesystem::path path; //!< Absolute path
+			Config::DictionaryStorage storage;
+			bool bFilter;
+		};
+
+		static UniqueDictionaryRegistryPtr s_pInstance; //!< Singleton instance
+		static std::mutex s_mutex;
+
+		mutable std::mutex m_mutex; //!< Guards all members below
+		std::unordered_map<std::string, Entry> m_dictionaries; //!< Loaded dictionaries by key
+		std::unordered_map<std::string, PendingDictionary> m_loading; //!< Loads in progress by key
+		StrongMutableDictionaryPtr m_pUserDictionary; //!< Loaded on first use
+		UniqueFileWatcherPtr m_pWatcher; //!< Set while hot reloading is enabled
+		Stats m_stats;
+	public:
+		/**
+		 * Retrieve a handle to a dictionary, loading it if no one holds it.
+		 *
+		 * Concurrent requests for the same dictionary wait for a single load,
+		 * which runs without holding the registry lock.
+		 */
+		DictionaryHandle Acquire(const std::filesystem::path &kPath, Config::DictionaryStorage storage,
+								 bool bFilter = false);
+		//! Retrieve the dictionary named in the user configuration.
+		DictionaryHandle AcquireConfigured(void);
+		/**
+		 * Retrieve a dictionary without waiting for it to load.
+		 *
+		 * Loading runs on threadPool; the future is ready at once if the
+		 * dictionary is already loaded, and rethrows any load error.
+		 */
+		PendingDictionary AcquireAsync(ThreadPool &threadPool, const std::filesystem::path &kPath,
+									   Config::DictionaryStorage storage, bool bFilter = false);
+		PendingDictionary AcquireConfiguredAsync(ThreadPool &threadPool);
+		/**
+		 * Retrieve the user dictionary shared by every document.
+		 *
+		 * On first use it is filled from the configured user dictionary file.
+		 */
+		StrongMutableDictionaryPtr GetUserDictionary(void);
+		//! Write the user dictionary back to its configured file (if it was used).
+		void SaveUserDictionary(void) const;
+		/**
+		 * Watch the files of loaded (& later loaded) dictionaries for changes.
+		 *
+		 * A changed user dictionary file replaces the user dictionary's words.
+		 * Hunspell dictionaries reload when either their .dic or .aff changes.
+		 * Returns false if file watching is unsupported on this platform.
+		 */
+		bool EnableHotReload(void);
+		void DisableHotReload(void);
+		// Accessors:
+		//! Retrieve singleton instance.
+		static DictionaryRegistry &Get(void);
+		//! Retrieve the number of dictionaries currently loaded.
+		std::size_t GetNumLoaded(void) const;
+		Stats GetStats(void) const;
+	private:
+		// Hide constructor so instances cannot be created directly.
+		DictionaryRegistry(void);
+
+		/**
+		 * Find a loaded (or loading) dictionary, otherwise register promise as its load.
+		 *
+		 * Returns true if the caller has to Load() it.
+		 */
+		bool Reserve(const std::string &kKey, std::promise<DictionaryHandle> &promise, PendingDictionary &pending);
+		//! Load & register a dictionary, fulfilling promise with it (or the load error).
+		void Load(const std::string &kKey, const std::filesystem::path &kPath, Config::DictionaryStorage storage,
+				  bool bFilter, std::promise<DictionaryHandle> &promise);
+		//! Reload every dictionary loaded from a changed file (watcher thread).
+		void OnFileChanged(const std::filesystem::path &kPath);
+		static std::string MakeKey(const std::filesystem::path &kPath, Config::DictionaryStorage storage, bool bFilter);
+		//! Retrieve the files a dictionary is loaded from (both halves of a Hunspell dictionary).
+		static std::vector<std::filesystem::path> GetSourceFiles(const std::filesystem::path &kPath);
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_DICTIONARYREGISTRY_HPP */
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * @file   FilteredDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Dictionary decorator with a Bloom filter front end.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "FilteredDictionary.hpp"
+
+using Lexi::FilteredDictionary;
+
+FilteredDictionary::FilteredDictionary(UniqueIDictionaryPtr pDictionary, std::size_t bitsPerWord)
+	: m_pDictionary(std::move(pDictionary)),
+	  m_filter{},
+	  m_numQueries(0),
+	  m_numRejected(0),
+	  m_numFalsePositives(0)
+{
+	LEXI_THROW_IF(!m_pDictionary, "Can't filter a null dictionary!");
+
+	m_filter = BloomFilter(m_pDictionary->VGetSize(), bitsPerWord);
+	m_pDictionary->VForEachWord([this](std::string_view word) { m_filter.Insert(word); });
+}
+
+bool FilteredDictionary::VContains(std::string_view word) const
+{
+	// Relaxed ordering is enough; the counters are only ever read as a snapshot.
+	m_numQueries.fetch_add(1, std::memory_order_relaxed);
+	if (!m_filter.MayContain(word))
+	{
+		m_numRejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	const bool kbContains = m_pDictionary->VContains(word);
+	if (!kbContains)
+	{
+		m_numFalsePositives.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	return kbContains;
+}
+
+void FilteredDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	m_pDictionary->VForEachWord(kFunc);
+}
+
+std::size_t FilteredDictionary::VGetSize(void) const noexcept
+{
+	return m_pDictionary->VGetSize();
+}
+
+std::size_t FilteredDictionary::VGetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_pDictionary->VGetMemoryUsage() + m_filter.GetMemoryUsage() - sizeof(m_filter);
+}
+
+const Lexi::IDictionary &FilteredDictionary::GetDictionary(void) const noexcept
+{
+	return *m_pDictionary;
+}
+
+FilteredDictionary::Stats FilteredDictionary::GetStats(void) const noexcept
+{
+	return Stats{
+		.numQueries = m_numQueries.load(std::memory_order_relaxed),
+		.numRejected = m_numRejected.load(std::memory_order_relaxed),
+		.numFalsePositives = m_numFalsePositives.load(std::memory_order_relaxed)
+	};
+}
+
+void FilteredDictionary::ResetStats(void) noexcept
+{
+	m_numQueries.store(0, std::memory_order_relaxed);
+	m_numRejected.store(0, std::memory_order_relaxed);
+	m_numFalsePositives.store(0, std::memory_order_relaxed);
+}
+
+double FilteredDictionary::Stats::GetHitRate(void) const noexcept
+{
+	return (numQueries > 0) ? static_cast<double>(numRejected) / static_cast<double>(numQueries) : 0.0;
+}
+
+double FilteredDictionary::Stats::GetFalsePositiveRate(void) const noexcept
+{
+	const std::uint64_t kNumAbsent = numRejected + numFalsePositives;
+	return (kNumAbsent > 0) ? static_cast<double>(numFalsePositives) / static_cast<double>(kNumAbsent) : 0.0;
+}
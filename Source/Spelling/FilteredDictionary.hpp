@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * @file   FilteredDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Dictionary decorator with a Bloom filter front end.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_FILTEREDDICTIONARY_HPP
+#define LEXI_FILTEREDDICTIONARY_HPP
+
+namespace Lexi
+{
+	class FilteredDictionary;
+	LEXI_DECLARE_PTR(FilteredDictionary);
+
+	/**
+	 * Decorator that answers most misses from a Bloom filter.
+	 *
+	 * The filter is built from every word of the wrapped dictionary, so a word
+	 * it rejects is certainly misspelled and the full lookup is skipped.
+	 */
+	class FilteredDictionary final : public IDictionary
+	{
+	public:
+		//! Snapshot of the lookup counters.
+		struct Stats
+		{
+			std::uint64_t numQueries; //!< Total lookups
+			std::uint64_t numRejected; //!< Lookups answered by the filter alone
+			std::uint64_t numFalsePositives; //!< Filter passes the dictionary rejected
+			//! Fraction of lookups that skipped the wrapped dictionary.
+			double GetHitRate(void) const noexcept;
+			//! Fraction of absent words the filter let through.
+			double GetFalsePositiveRate(void) const noexcept;
+		};
+	private:
+		UniqueIDictionaryPtr m_pDictionary; //!< Wrapped dictionary
+		BloomFilter m_filter; //!< Filter over every word in m_pDictionary
+		mutable std::atomic<std::uint64_t> m_numQueries;
+		mutable std::atomic<std::uint64_t> m_numRejected;
+		mutable std::atomic<std::uint64_t> m_numFalsePositives;
+	public:
+		explicit FilteredDictionary(UniqueIDictionaryPtr pDictionary,
+									std::size_t bitsPerWord = BloomFilter::kDEFAULT_BITS_PER_KEY);
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const override;
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		//! Includes the filter.
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		// Accessors:
+		const IDictionary &GetDictionary(void) const noexcept;
+		Stats GetStats(void) const noexcept;
+		void ResetStats(void) noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_FILTEREDDICTIONARY_HPP */
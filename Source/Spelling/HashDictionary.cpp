@@ -0,0 +1,473 @@
+/*******************************************************************************
+ * @file   HashDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Open-addressing hash set of dictionary words.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "HashDictionary.hpp"
+
+using Lexi::HashDictionary;
+
+HashDictionary::HashDictionary(void)
+	: m_pool{},
+	  m_slots(kMIN_CAPACITY),
+	  m_pMapping{},
+	  m_pPool(nullptr),
+	  m_pSlots(nullptr),
+	  m_capacity(0),
+	  m_poolSize(0),
+	  m_size(0)
+{
+	BindOwned();
+}
+
+HashDictionary::HashDictionary(const std::filesystem::path &kPath)
+	: HashDictionary()
+{
+	auto pMapping = std::make_unique<MemoryMappedFile>(kPath);
+	if (BindMapping(*pMapping))
+	{
+		m_pMapping = std::move(pMapping);
+	}
+	else
+	{
+		// Not a compiled dictionary; fall back to the plain text word list.
+		ParseText(pMapping->GetText());
+	}
+}
+
+HashDictionary::HashDictionary(HashDictionary &&other) noexcept
+	: HashDictionary()
+{
+	*this = std::move(other);
+}
+
+HashDictionary &HashDictionary::operator=(HashDictionary &&other) noexcept
+{
+	if (this != &other)
+	{
+		const bool kbMapped = other.IsMapped();
+		m_pool.swap(other.m_pool);
+		m_slots.swap(other.m_slots);
+		m_pMapping.swap(other.m_pMapping);
+		std::swap(m_pPool, other.m_pPool);
+		std::swap(m_pSlots, other.m_pSlots);
+		std::swap(m_capacity, other.m_capacity);
+		std::swap(m_poolSize, other.m_poolSize);
+		std::swap(m_size, other.m_size);
+		// Owned buffers keep their addresses when swapped, but rebind anyway
+		// so neither side ever points at the other's storage.
+		if (!kbMapped)
+		{
+			BindOwned();
+		}
+
+		if (!other.IsMapped())
+		{
+			other.BindOwned();
+		}
+	}
+
+	return *this;
+}
+
+bool HashDictionary::Insert(std::string_view word)
+{
+	if (word.empty() || word.size() > kMAX_WORD_LENGTH)
+	{
+		return false;
+	}
+
+	Detach();
+	const std::uint8_t kCaseFlag = GetCaseFlag(CaseFolding::GetWordCase(word));
+	const std::size_t kPoolGrowth = (kCaseFlag == kCASE_MIXED) ? word.size() * 2 : word.size();
+	LEXI_THROW_IF(m_pool.size() + kPoolGrowth > std::numeric_limits<std::uint32_t>::max(),
+				  "Word dictionary is too large!");
+
+	const std::uint32_t kHash = HashWord(word);
+	std::size_t index = FindSlot(word, kHash);
+	if (m_slots[index].length != 0)
+	{
+		// Known key: all caps is always accepted, and only the first mixed spelling is kept.
+		Slot &slot = m_slots[index];
+		if (kCaseFlag == 0 || (slot.caseFlags & kCaseFlag) != 0)
+		{
+			return false;
+		}
+
+		if (kCaseFlag == kCASE_MIXED)
+		{
+			// The spelling has to follow the key, so move the key to the end of the pool.
+			const std::size_t kOldOffset = slot.offset;
+			slot.offset = static_cast<std::uint32_t>(m_pool.size());
+			m_pool.resize(m_pool.size() + word.size());
+			std::copy_n(m_pool.begin() + static_cast<std::ptrdiff_t>(kOldOffset), word.size(),
+						m_pool.begin() + static_cast<std::ptrdiff_t>(slot.offset));
+			m_pool.insert(m_pool.end(), word.begin(), word.end());
+		}
+
+		slot.caseFlags |= kCaseFlag;
+		BindOwned();
+		return true;
+	}
+
+	if ((m_size + 1) * kMAX_LOAD_DEN > m_slots.size() * kMAX_LOAD_NUM)
+	{
+		Rehash(m_slots.size() * 2);
+		index = FindSlot(word, kHash);
+	}
+
+	const std::size_t kOffset = m_pool.size();
+	m_pool.resize(kOffset + word.size());
+	CaseFolding::FoldWord(word, m_pool.data() + kOffset);
+	if (kCaseFlag == kCASE_MIXED)
+	{
+		m_pool.insert(m_pool.end(), word.begin(), word.end());
+	}
+
+	m_slots[index] = Slot{ kHash, static_cast<std::uint32_t>(kOffset), static_cast<std::uint16_t>(word.size()),
+						   kCaseFlag, 0 };
+	++m_size;
+	BindOwned();
+	return true;
+}
+
+bool HashDictionary::VContains(std::string_view word) const noexcept
+{
+	if (word.empty() || word.size() > kMAX_WORD_LENGTH)
+	{
+		return false;
+	}
+
+	const Slot &kSlot = m_pSlots[FindSlot(word, HashWord(word))];
+	if (kSlot.length == 0)
+	{
+		return false;
+	}
+
+	switch (CaseFolding::GetWordCase(word))
+	{
+	case WordCase::kLower:
+		return (kSlot.caseFlags & kCASE_LOWER) != 0;
+	case WordCase::kCapitalized:
+		return (kSlot.caseFlags & (kCASE_LOWER | kCASE_CAPITALIZED)) != 0;
+	case WordCase::kUpper:
+		return true;
+	default:
+		return (kSlot.caseFlags & kCASE_MIXED) != 0 && GetSlotSpelling(kSlot) == word;
+	}
+}
+
+void HashDictionary::Reserve(std::size_t numWords)
+{
+	Detach();
+	std::size_t capacity = std::bit_ceil(std::max(kMIN_CAPACITY, numWords * kMAX_LOAD_DEN / kMAX_LOAD_NUM + 1));
+	if (capacity > m_slots.size())
+	{
+		Rehash(capacity);
+	}
+}
+
+void HashDictionary::Clear(void)
+{
+	if (IsMapped())
+	{
+		m_pMapping.reset();
+		m_slots.assign(kMIN_CAPACITY, Slot{});
+	}
+	else
+	{
+		std::ranges::fill(m_slots, Slot{});
+	}
+
+	m_pool.clear();
+	m_size = 0;
+	BindOwned();
+}
+
+void HashDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	std::string spelling;
+	for (const Slot &kSlot : std::span<const Slot>(m_pSlots, m_capacity))
+	{
+		if (kSlot.length == 0)
+		{
+			continue;
+		}
+
+		const std::string_view kKey = GetSlotWord(kSlot);
+		if (kSlot.caseFlags & kCASE_LOWER)
+		{
+			kFunc(kKey);
+		}
+
+		if (kSlot.caseFlags & kCASE_CAPITALIZED)
+		{
+			spelling.assign(kKey);
+			CaseFolding::CapitalizeWord(spelling, spelling.data());
+			kFunc(spelling);
+		}
+
+		if (kSlot.caseFlags & kCASE_MIXED)
+		{
+			kFunc(GetSlotSpelling(kSlot));
+		}
+
+		if (kSlot.caseFlags == 0)
+		{
+			spelling.assign(kKey);
+			CaseFolding::UpperWord(spelling, spelling.data());
+			kFunc(spelling);
+		}
+	}
+}
+
+void HashDictionary::SaveBinary(const std::filesystem::path &kPath) const
+{
+	FileHeader header{};
+	std::ranges::copy(kFILE_MAGIC, header.magic);
+	header.version = kFILE_VERSION;
+	header.byteOrder = kBYTE_ORDER_MARK;
+	header.numWords = m_size;
+	header.capacity = m_capacity;
+	// Keep the slot table aligned so the mapped file can be used in place.
+	header.slotsOffset = (sizeof(FileHeader) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+	header.poolOffset = header.slotsOffset + m_capacity * sizeof(Slot);
+	header.poolSize = m_poolSize;
+
+	// Written next to the target & renamed over it, so a running editor mapping the old file keeps a valid view.
+	std::filesystem::path tempPath = kPath;
+	tempPath += ".tmp";
+	{
+		std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+		LEXI_THROW_IF(!outFile, "Couldn't create the compiled dictionary!");
+
+		const std::vector<char> kPadding(header.slotsOffset - sizeof(FileHeader), '\0');
+		outFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+		outFile.write(kPadding.data(), static_cast<std::streamsize>(kPadding.size()));
+		outFile.write(reinterpret_cast<const char *>(m_pSlots), static_cast<std::streamsize>(m_capacity * sizeof(Slot)));
+		outFile.write(m_pPool, static_cast<std::streamsize>(header.poolSize));
+		outFile.close();
+		LEXI_THROW_IF(!outFile, "Couldn't write the compiled dictionary!");
+	}
+
+	std::filesystem::rename(tempPath, kPath);
+}
+
+std::size_t HashDictionary::VGetSize(void) const noexcept
+{
+	return m_size;
+}
+
+std::size_t HashDictionary::GetCapacity(void) const noexcept
+{
+	return m_capacity;
+}
+
+std::size_t HashDictionary::VGetMemoryUsage(void) const noexcept
+{
+	if (IsMapped())
+	{
+		return sizeof(*this) + sizeof(MemoryMappedFile) + m_pMapping->GetSize();
+	}
+
+	return sizeof(*this) + m_pool.capacity() + m_slots.capacity() * sizeof(Slot);
+}
+
+bool HashDictionary::IsMapped(void) const noexcept
+{
+	return static_cast<bool>(m_pMapping);
+}
+
+std::uint32_t HashDictionary::HashWord(std::string_view word) noexcept
+{
+	// 64-bit FNV-1a over the case-folded word, folded down to 32 bits.
+	std::uint64_t hash = 14695981039346656037ULL;
+	CaseFolding::ForEachFoldedByte(word, [&hash](char ch)
+	{
+		hash ^= static_cast<unsigned char>(ch);
+		hash *= 1099511628211ULL;
+	});
+
+	return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+std::size_t HashDictionary::FindSlot(std::string_view word, std::uint32_t hash) const noexcept
+{
+	const std::size_t kMask = m_capacity - 1;
+	// The load factor guarantees an empty slot, so probing always terminates.
+	for (std::size_t index = hash & kMask; ; index = (index + 1) & kMask)
+	{
+		const Slot &kSlot = m_pSlots[index];
+		if (kSlot.length == 0 ||
+			(kSlot.hash == hash && kSlot.length == word.size() && CaseFolding::EqualsFolded(GetSlotWord(kSlot), word)))
+		{
+			return index;
+		}
+	}
+}
+
+std::string_view HashDictionary::GetSlotWord(const Slot &kSlot) const noexcept
+{
+	return std::string_view(m_pPool + kSlot.offset, kSlot.length);
+}
+
+std::string_view HashDictionary::GetSlotSpelling(const Slot &kSlot) const noexcept
+{
+	return std::string_view(m_pPool + kSlot.offset + kSlot.length, kSlot.length);
+}
+
+std::uint8_t HashDictionary::GetCaseFlag(WordCase wordCase) noexcept
+{
+	switch (wordCase)
+	{
+	case WordCase::kLower:
+		return kCASE_LOWER;
+	case WordCase::kCapitalized:
+		return kCASE_CAPITALIZED;
+	case WordCase::kMixed:
+		return kCASE_MIXED;
+	default:
+		return 0; // All caps entries accept nothing else
+	}
+}
+
+void HashDictionary::Rehash(std::size_t capacity)
+{
+	std::vector<Slot> oldSlots(capacity);
+	oldSlots.swap(m_slots);
+
+	const std::size_t kMask = m_slots.size() - 1;
+	for (const Slot &kSlot : oldSlots)
+	{
+		if (kSlot.length == 0)
+		{
+			continue;
+		}
+
+		std::size_t index = kSlot.hash & kMask;
+		while (m_slots[index].length != 0)
+		{
+			index = (index + 1) & kMask;
+		}
+
+		m_slots[index] = kSlot;
+	}
+
+	BindOwned();
+}
+
+void HashDictionary::ParseText(std::string_view text)
+{
+	Reserve(static_cast<std::size_t>(std::ranges::count(text, '\n')) + 1);
+	m_pool.reserve(m_pool.size() + text.size());
+
+	constexpr std::string_view kSPACE = " \t\r\v\f";
+	for (std::size_t lineStart = 0; lineStart < text.size(); )
+	{
+		std::size_t lineEnd = text.find('\n', lineStart);
+		if (lineEnd == std::string_view::npos)
+		{
+			lineEnd = text.size();
+		}
+		// Only the first token of each line is a word.
+		std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+		const std::size_t kWordStart = line.find_first_not_of(kSPACE);
+		if (kWordStart != std::string_view::npos)
+		{
+			line.remove_prefix(kWordStart);
+			Insert(line.substr(0, line.find_first_of(kSPACE)));
+		}
+
+		lineStart = lineEnd + 1;
+	}
+}
+
+bool HashDictionary::BindMapping(const MemoryMappedFile &kMapping)
+{
+	const std::span<const char> kBytes = kMapping.GetBytes();
+	if (kBytes.size() < sizeof(FileHeader) ||
+		std::string_view(kBytes.data(), kFILE_MAGIC.size()) != kFILE_MAGIC)
+	{
+		return false;
+	}
+
+	FileHeader header;
+	std::memcpy(&header, kBytes.data(), sizeof(header));
+	LEXI_THROW_IF(header.byteOrder != kBYTE_ORDER_MARK, "Compiled dictionary has the wrong byte order!");
+	LEXI_THROW_IF(header.version != kFILE_VERSION,
+				  std::format("Unsupported compiled dictionary version {} (expected {})!", header.version, kFILE_VERSION));
+
+	const bool kbValidTable = header.capacity >= kMIN_CAPACITY && std::has_single_bit(header.capacity) &&
+		header.numWords < header.capacity && header.slotsOffset % alignof(Slot) == 0 &&
+		header.slotsOffset <= kBytes.size() && header.capacity <= (kBytes.size() - header.slotsOffset) / sizeof(Slot);
+	const bool kbValidPool = header.poolOffset <= kBytes.size() && header.poolSize <= kBytes.size() - header.poolOffset;
+	LEXI_THROW_IF(!kbValidTable || !kbValidPool, "Compiled dictionary is corrupt!");
+
+	const auto *pSlots = reinterpret_cast<const Slot *>(kBytes.data() + header.slotsOffset);
+	// Reject slots pointing outside of the pool, and tables without an empty
+	// slot, so lookups never leave the mapping or probe forever.
+	std::uint64_t numUsed = 0;
+	for (const Slot &kSlot : std::span<const Slot>(pSlots, header.capacity))
+	{
+		const std::uint64_t kEntrySize = (kSlot.caseFlags & kCASE_MIXED) ? kSlot.length * 2ULL : kSlot.length;
+		LEXI_THROW_IF(std::uint64_t{ kSlot.offset } + kEntrySize > header.poolSize, "Compiled dictionary is corrupt!");
+		numUsed += (kSlot.length != 0);
+	}
+	LEXI_THROW_IF(numUsed != header.numWords, "Compiled dictionary is corrupt!");
+
+	m_pool.clear();
+	m_slots.clear();
+	m_pPool = kBytes.data() + header.poolOffset;
+	m_pSlots = pSlots;
+	m_capacity = header.capacity;
+	m_poolSize = header.poolSize;
+	m_size = header.numWords;
+	return true;
+}
+
+void HashDictionary::Detach(void)
+{
+	if (!IsMapped())
+	{
+		return;
+	}
+
+	m_slots.assign(m_pSlots, m_pSlots + m_capacity);
+	m_pool.assign(m_pPool, m_pPool + m_poolSize);
+	m_pMapping.reset();
+	BindOwned();
+}
+
+void HashDictionary::BindOwned(void) noexcept
+{
+	m_pPool = m_pool.data();
+	m_pSlots = m_slots.data();
+	m_capacity = m_slots.size();
+	m_poolSize = m_pool.size();
+}
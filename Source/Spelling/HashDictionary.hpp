@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * @file   HashDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Open-addressing hash set of dictionary words.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_HASHDICTIONARY_HPP
+#define LEXI_HASHDICTIONARY_HPP
+
+namespace Lexi
+{
+	class HashDictionary;
+	LEXI_DECLARE_PTR(HashDictionary);
+
+	/**
+	 * Open-addressing (linear probing) hash set of words.
+	 *
+	 * Words are packed into a single character pool and the table only stores
+	 * (hash, offset, length, case flags) slots, so lookups work directly on a
+	 * std::string_view without building temporary strings. The same layout is
+	 * written by SaveBinary(), so a compiled dictionary file is memory-mapped
+	 * and used in place.
+	 *
+	 * Keys are stored case-folded. Each slot records which capitalizations
+	 * the word list contained, so lookups hash & compare the word as written
+	 * and then apply the CaseFolding rules. Mixed case spellings ("McDonald")
+	 * are kept in the pool right after their key.
+	 */
+	class HashDictionary final : public IDictionary
+	{
+	public:
+		//! Table slot referencing a word in the pool.
+		struct Slot
+		{
+			std::uint32_t hash; //!< Folded word hash
+			std::uint32_t offset; //!< Offset of the key in the pool
+			std::uint16_t length; //!< Length of the key (zero if the slot is empty)
+			std::uint8_t caseFlags; //!< Accepted capitalizations (kCASE_*)
+			std::uint8_t reserved;
+		};
+		//! Header of a compiled dictionary file.
+		struct FileHeader
+		{
+			char magic[8]; //!< Always kFILE_MAGIC
+			std::uint32_t version; //!< Format version (kFILE_VERSION)
+			std::uint32_t byteOrder; //!< kBYTE_ORDER_MARK in the writer's byte order
+			std::uint64_t numWords; //!< Number of words stored
+			std::uint64_t capacity; //!< Number of slots (a power of two)
+			std::uint64_t slotsOffset; //!< File offset of the slot table
+			std::uint64_t poolOffset; //!< File offset of the character pool
+			std::uint64_t poolSize; //!< Size of the character pool in bytes
+		};
+
+		static constexpr std::string_view kFILE_MAGIC = "LEXIDICT";
+		static constexpr std::uint32_t kFILE_VERSION = 3; // 2: case-folded keys with case flags, 3: UTF-8 case folding
+		static constexpr std::uint32_t kBYTE_ORDER_MARK = 0x01020304;
+		static constexpr std::size_t kMAX_WORD_LENGTH = std::numeric_limits<std::uint16_t>::max();
+		// Slot case flags, all caps is always accepted:
+		static constexpr std::uint8_t kCASE_LOWER = 1 << 0; //!< Listed in lowercase
+		static constexpr std::uint8_t kCASE_CAPITALIZED = 1 << 1; //!< Listed capitalized
+		static constexpr std::uint8_t kCASE_MIXED = 1 << 2; //!< Listed in mixed case (spelling follows the key)
+	private:
+		static constexpr std::size_t kMIN_CAPACITY = 16; //!< Smallest table size
+		static constexpr std::size_t kMAX_LOAD_NUM = 3; //!< Maximum load factor numerator
+		static constexpr std::size_t kMAX_LOAD_DEN = 4; //!< Maximum load factor denominator
+
+		std::vector<char> m_pool; //!< Packed word characters
+		std::vector<Slot> m_slots; //!< Power-of-two sized probe table
+		UniqueMemoryMappedFilePtr m_pMapping; //!< Compiled dictionary viewed in place
+		const char *m_pPool; //!< Active pool (owned or mapped)
+		const Slot *m_pSlots; //!< Active table (owned or mapped)
+		std::size_t m_capacity; //!< Number of slots in the active table
+		std::size_t m_poolSize; //!< Number of bytes in the active pool
+		std::size_t m_size; //!< Number of words stored
+	public:
+		HashDictionary(void);
+		/**
+		 * Load a dictionary file.
+		 *
+		 * Files produced by SaveBinary() are mapped and used in place, anything
+		 * else is parsed as a word list containing one word per line.
+		 */
+		explicit HashDictionary(const std::filesystem::path &kPath);
+		HashDictionary(const HashDictionary &) = delete;
+		HashDictionary &operator=(const HashDictionary &) = delete;
+		HashDictionary(HashDictionary &&other) noexcept;
+		HashDictionary &operator=(HashDictionary &&other) noexcept;
+
+		//! Insert a word, returns false if this spelling was already present (or is too long).
+		bool Insert(std::string_view word);
+		//! Reserve table space for a number of words.
+		void Reserve(std::size_t numWords);
+		//! Remove all words.
+		void Clear(void);
+		//! Write the dictionary in the compiled (memory-mappable) format.
+		void SaveBinary(const std::filesystem::path &kPath) const;
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const noexcept override;
+		//! Words are visited once per listed spelling.
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		// Accessors:
+		std::size_t GetCapacity(void) const noexcept;
+		//! Determine whether or not the dictionary is viewing a mapped file.
+		bool IsMapped(void) const noexcept;
+		//! Case-insensitive hash function used for table lookups.
+		static std::uint32_t HashWord(std::string_view word) noexcept;
+	private:
+		//! Find the slot whose key folds equal to word, or the empty slot where it belongs.
+		std::size_t FindSlot(std::string_view word, std::uint32_t hash) const noexcept;
+		std::string_view GetSlotWord(const Slot &kSlot) const noexcept;
+		//! Retrieve the mixed case spelling stored after the key (kCASE_MIXED only).
+		std::string_view GetSlotSpelling(const Slot &kSlot) const noexcept;
+		static std::uint8_t GetCaseFlag(WordCase wordCase) noexcept;
+		void Rehash(std::size_t capacity);
+		void ParseText(std::string_view text);
+		//! Point lookups at the compiled file, returns false if it is not one.
+		bool BindMapping(const MemoryMappedFile &kMapping);
+		//! Copy mapped data into owned storage before modification.
+		void Detach(void);
+		//! Point lookups at the owned storage.
+		void BindOwned(void) noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_HASHDICTIONARY_HPP */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * @file   IDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Interface for word dictionaries.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "IDictionary.hpp"
+
+std::uint64_t Lexi::IDictionary::VGetGeneration(void) const noexcept
+{
+	return 0;
+}
+
+Lexi::UniqueIDictionaryPtr Lexi::LoadDictionary(const std::filesystem::path &kPath, Config::DictionaryStorage storage,
+												 bool bFilter)
+{
+	UniqueIDictionaryPtr pDictionary;
+	if (AffixDictionary::IsAffixFile(kPath))
+	{
+		// Stems & affix rules have a representation of their own.
+		pDictionary = std::make_unique<AffixDictionary>(kPath);
+	}
+	else if (storage == Config::DictionaryStorage::kHash)
+	{
+		pDictionary = std::make_unique<HashDictionary>(kPath);
+	}
+	else if (storage == Config::DictionaryStorage::kDawg)
+	{
+		pDictionary = std::make_unique<DawgDictionary>(kPath);
+	}
+	else
+	{
+		LEXI_THROW("Invalid word dictionary storage.");
+	}
+
+	if (bFilter)
+	{
+		pDictionary = std::make_unique<FilteredDictionary>(std::move(pDictionary));
+	}
+
+	return pDictionary;
+}
+
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * @file   IDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Interface for word dictionaries.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_IDICTIONARY_HPP
+#define LEXI_IDICTIONARY_HPP
+
+namespace Lexi
+{
+	class IDictionary;
+	LEXI_DECLARE_PTR(IDictionary);
+	//! Interface for word lists queried by the spell checker.
+	class IDictionary
+	{
+	public:
+		using WordFunc = std::function<void (std::string_view word)>;
+
+		virtual ~IDictionary(void) = default;
+		/**
+		 * Determine whether or not the dictionary contains a word.
+		 *
+		 * The word is passed as written; capitalization is matched following
+		 * the CaseFolding rules, so callers never lowercase it first.
+		 */
+		virtual bool VContains(std::string_view word) const = 0;
+		//! Invoke func once for every word (order is unspecified).
+		virtual void VForEachWord(const WordFunc &kFunc) const = 0;
+		//! Retrieve the number of words stored.
+		virtual std::size_t VGetSize(void) const noexcept = 0;
+		//! Retrieve the number of bytes used to store the words.
+		virtual std::size_t VGetMemoryUsage(void) const noexcept = 0;
+		/**
+		 * Retrieve a counter that changes whenever the accepted words do.
+		 *
+		 * Results cached by callers are stale once it differs from the value
+		 * they were computed at. Immutable dictionaries always return zero.
+		 */
+		virtual std::uint64_t VGetGeneration(void) const noexcept;
+	};
+	//! Shared, read-only reference to a loaded dictionary (see DictionaryRegistry).
+	using DictionaryHandle = std::shared_ptr<const IDictionary>;
+	//! Dictionary that may still be loading (see DictionaryRegistry::AcquireAsync()).
+	using PendingDictionary = std::shared_future<DictionaryHandle>;
+
+	/**
+	 * Load a word dictionary (plain or compiled) into the requested storage.
+	 *
+	 * Hunspell style dictionaries (.dic/.aff) are loaded as an AffixDictionary
+	 * regardless of storage.
+	 *
+	 * If bFilter is set, the dictionary is wrapped in a FilteredDictionary.
+	 */
+	UniqueIDictionaryPtr LoadDictionary(const std::filesystem::path &kPath, Config::DictionaryStorage storage,
+										bool bFilter = false);
+} // End namespace (Lexi)
+
+#endif /* !LEXI_IDICTIONARY_HPP */
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * @file   IncrementalSpellChecker.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Per-row spell checking with cached results.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "IncrementalSpellChecker.hpp"
+
+using Lexi::IncrementalSpellChecker;
+
+IncrementalSpellChecker::IncrementalSpellChecker(const IDictionary &kDictionary)
+	: m_pDictionary(&kDictionary),
+	  m_rows{},
+	  m_cache{},
+	  m_generation(kDictionary.VGetGeneration()),
+	  m_stats{}
+{
+}
+
+void IncrementalSpellChecker::SetRow(std::size_t rowIndex, std::string_view text)
+{
+	Refresh();
+	while (m_rows.size() < rowIndex)
+	{
+		m_rows.push_back(Acquire({}));
+	}
+
+	++m_stats.numRowUpdates;
+	if (rowIndex == m_rows.size())
+	{
+		m_rows.push_back(Acquire(text));
+		return;
+	}
+
+	CacheSlot *pOldSlot = m_rows[rowIndex];
+	m_rows[rowIndex] = Acquire(text);
+	Release(pOldSlot);
+}
+
+void IncrementalSpellChecker::InsertRow(std::size_t rowIndex, std::string_view text)
+{
+	LEXI_THROW_IF(rowIndex > m_rows.size(), "Row index out of range!");
+
+	Refresh();
+	++m_stats.numRowUpdates;
+	m_rows.insert(m_rows.begin() + static_cast<std::ptrdiff_t>(rowIndex), Acquire(text));
+}
+
+void IncrementalSpellChecker::EraseRow(std::size_t rowIndex)
+{
+	LEXI_THROW_IF(rowIndex >= m_rows.size(), "Row index out of range!");
+
+	Release(m_rows[rowIndex]);
+	m_rows.erase(m_rows.begin() + static_cast<std::ptrdiff_t>(rowIndex));
+}
+
+void IncrementalSpellChecker::Clear(void)
+{
+	m_rows.clear();
+	m_cache.clear();
+}
+
+bool IncrementalSpellChecker::Refresh(void)
+{
+	const std::uint64_t kGeneration = m_pDictionary->VGetGeneration();
+	if (kGeneration == m_generation)
+	{
+		return false;
+	}
+
+	// Rows keep their slots, only the results are replaced.
+	m_generation = kGeneration;
+	++m_stats.numRefreshes;
+	for (auto &[kText, entry] : m_cache)
+	{
+		++m_stats.numRowsChecked;
+		entry.misspellings = CheckText(*m_pDictionary, kText, &m_stats.numWordsChecked);
+	}
+
+	return true;
+}
+
+std::size_t IncrementalSpellChecker::GetNumRows(void) const noexcept
+{
+	return m_rows.size();
+}
+
+std::span<const Lexi::WordRange> IncrementalSpellChecker::GetRowMisspellings(std::size_t rowIndex) const
+{
+	LEXI_THROW_IF(rowIndex >= m_rows.size(), "Row index out of range!");
+
+	return m_rows[rowIndex]->second.misspellings;
+}
+
+const IncrementalSpellChecker::Stats &IncrementalSpellChecker::GetStats(void) const noexcept
+{
+	return m_stats;
+}
+
+Lexi::WordRangeVector IncrementalSpellChecker::CheckText(const IDictionary &kDictionary, std::string_view text,
+														 std::uint64_t *pNumWords)
+{
+	WordRangeVector misspellings;
+	WordTokenizer::ForEachWord(text, [&](const WordRange &kRange)
+	{
+		if (pNumWords)
+		{
+			++*pNumWords;
+		}
+
+		if (!kDictionary.VContains(text.substr(kRange.offset, kRange.length)))
+		{
+			misspellings.push_back(kRange);
+		}
+	});
+
+	return misspellings;
+}
+
+IncrementalSpellChecker::CacheSlot *IncrementalSpellChecker::Acquire(std::string_view text)
+{
+	auto iter = m_cache.find(text);
+	if (iter == m_cache.end())
+	{
+		++m_stats.numRowsChecked;
+		iter = m_cache.emplace(text, CacheEntry{ CheckText(*m_pDictionary, text, &m_stats.numWordsChecked), 0 }).first;
+	}
+	else
+	{
+		++m_stats.numCacheHits;
+	}
+
+	++iter->second.numRefs;
+	return &*iter;
+}
+
+void IncrementalSpellChecker::Release(CacheSlot *pSlot)
+{
+	if (--pSlot->second.numRefs == 0)
+	{
+		m_cache.erase(m_cache.find(pSlot->first));
+	}
+}
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * @file   IncrementalSpellChecker.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Per-row spell checking with cached results.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_INCREMENTALSPELLCHECKER_HPP
+#define LEXI_INCREMENTALSPELLCHECKER_HPP
+
+namespace Lexi
+{
+	class IncrementalSpellChecker;
+	LEXI_DECLARE_PTR(IncrementalSpellChecker);
+
+	/**
+	 * Spell checker that keeps results per row.
+	 *
+	 * Results are cached by the row's content and shared between rows with
+	 * the same text, so after an edit only rows whose text actually changed
+	 * are tokenized & looked up again. When the dictionary's generation
+	 * changes, the next edit or Refresh() checks every distinct row again.
+	 */
+	class IncrementalSpellChecker
+	{
+	public:
+		//! Work counters.
+		struct Stats
+		{
+			std::uint64_t numRowUpdates; //!< Calls that supplied row text
+			std::uint64_t numRowsChecked; //!< Rows tokenized & looked up
+			std::uint64_t numCacheHits; //!< Rows answered from the cache
+			std::uint64_t numWordsChecked; //!< Dictionary lookups
+			std::uint64_t numRefreshes; //!< Times the dictionary changed under the cached results
+		};
+	private:
+		//! Hashes any string type, so looking a row up needs no std::string.
+		struct TextHash
+		{
+			using is_transparent = void;
+
+			std::size_t operator()(std::string_view text) const noexcept;
+		};
+		//! Cached result shared by every row with the same content.
+		struct CacheEntry
+		{
+			WordRangeVector misspellings; //!< Offsets relative to the row start
+			std::size_t numRefs; //!< Rows currently using this entry
+		};
+		//! Results by row text, each distinct text is stored once.
+		using Cache = std::unordered_map<std::string, CacheEntry, TextHash, std::equal_to<>>;
+		using CacheSlot = Cache::value_type;
+
+		const IDictionary *m_pDictionary; //!< Dictionary used for lookups
+		std::vector<CacheSlot *> m_rows; //!< Cache slot of each row (slots never move)
+		Cache m_cache;
+		std::uint64_t m_generation; //!< Dictionary generation the cached results were checked at
+		Stats m_stats;
+	public:
+		explicit IncrementalSpellChecker(const IDictionary &kDictionary);
+
+		//! Replace the text of a row (appending rows as needed).
+		void SetRow(std::size_t rowIndex, std::string_view text);
+		//! Insert a new row before rowIndex.
+		void InsertRow(std::size_t rowIndex, std::string_view text);
+		void EraseRow(std::size_t rowIndex);
+		void Clear(void);
+		/**
+		 * Check every row again if the dictionary changed since it was checked.
+		 *
+		 * Edits refresh first, call this before reading results after adding
+		 * words without editing. Returns whether or not anything was checked.
+		 */
+		bool Refresh(void);
+		// Accessors:
+		std::size_t GetNumRows(void) const noexcept;
+		//! Retrieve the misspellings of a row, offsets are relative to the row.
+		std::span<const WordRange> GetRowMisspellings(std::size_t rowIndex) const;
+		const Stats &GetStats(void) const noexcept;
+		//! Spell check text without caching, optionally counting the words looked up.
+		static WordRangeVector CheckText(const IDictionary &kDictionary, std::string_view text,
+										 std::uint64_t *pNumWords = nullptr);
+	private:
+		//! Reference the cache entry for text, checking it if it is not cached.
+		CacheSlot *Acquire(std::string_view text);
+		void Release(CacheSlot *pSlot);
+	};
+
+	inline std::size_t IncrementalSpellChecker::TextHash::operator()(std::string_view text) const noexcept
+	{
+		return std::hash<std::string_view>{}(text);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_INCREMENTALSPELLCHECKER_HPP */
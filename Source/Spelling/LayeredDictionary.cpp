@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * @file   LayeredDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Shared dictionary with user & per-document layers on top.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "LayeredDictionary.hpp"
+
+using Lexi::LayeredDictionary;
+
+LayeredDictionary::LayeredDictionary(DictionaryHandle pBase, StrongMutableDictionaryPtr pUserDictionary)
+	: m_pBase(std::move(pBase)),
+	  m_pUserDictionary(std::move(pUserDictionary)),
+	  m_ignoreList{}
+{
+	LEXI_THROW_IF(!m_pBase, "Layered dictionary needs a base dictionary!");
+}
+
+bool LayeredDictionary::Ignore(std::string_view word)
+{
+	return m_ignoreList.Insert(word);
+}
+
+bool LayeredDictionary::AddToUserDictionary(std::string_view word)
+{
+	return m_pUserDictionary && m_pUserDictionary->Insert(word);
+}
+
+bool LayeredDictionary::VContains(std::string_view word) const
+{
+	// Most words are found in the base, which needs no locking.
+	return m_pBase->VContains(word) || (m_pUserDictionary && m_pUserDictionary->VContains(word)) ||
+		   m_ignoreList.VContains(word);
+}
+
+void LayeredDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	m_pBase->VForEachWord(kFunc);
+	if (m_pUserDictionary)
+	{
+		m_pUserDictionary->VForEachWord(kFunc);
+	}
+}
+
+std::size_t LayeredDictionary::VGetSize(void) const noexcept
+{
+	return m_pBase->VGetSize() + (m_pUserDictionary ? m_pUserDictionary->VGetSize() : 0);
+}
+
+std::size_t LayeredDictionary::VGetMemoryUsage(void) const noexcept
+{
+	return (m_pUserDictionary ? m_pUserDictionary->VGetMemoryUsage() : 0) + m_ignoreList.VGetMemoryUsage();
+}
+
+std::uint64_t LayeredDictionary::VGetGeneration(void) const noexcept
+{
+	// Every layer only counts up, so the sum changes whenever one of them does.
+	return m_pBase->VGetGeneration() + (m_pUserDictionary ? m_pUserDictionary->VGetGeneration() : 0) +
+		   m_ignoreList.VGetGeneration();
+}
+
+const Lexi::IDictionary &LayeredDictionary::GetBase(void) const noexcept
+{
+	return *m_pBase;
+}
+
+const Lexi::DictionaryHandle &LayeredDictionary::GetBaseHandle(void) const noexcept
+{
+	return m_pBase;
+}
+
+Lexi::MutableDictionary *LayeredDictionary::GetUserDictionary(void) const noexcept
+{
+	return m_pUserDictionary.get();
+}
+
+const Lexi::MutableDictionary &LayeredDictionary::GetIgnoreList(void) const noexcept
+{
+	return m_ignoreList;
+}
+
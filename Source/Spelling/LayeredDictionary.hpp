@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * @file   LayeredDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Shared dictionary with user & per-document layers on top.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_LAYEREDDICTIONARY_HPP
+#define LEXI_LAYEREDDICTIONARY_HPP
+
+namespace Lexi
+{
+	class LayeredDictionary;
+	LEXI_DECLARE_PTR(LayeredDictionary);
+
+	/**
+	 * Per-document view of a shared dictionary.
+	 *
+	 * A word is accepted if the shared base, the user dictionary (shared by
+	 * every document) or this document's ignore list accepts it. The base is
+	 * never modified, so any number of views reference the same instance.
+	 *
+	 * Results computed before a word was added are not updated; callers notice
+	 * through VGetGeneration() & check the affected text again.
+	 */
+	class LayeredDictionary final : public IDictionary
+	{
+	private:
+		DictionaryHandle m_pBase; //!< Shared, immutable word list
+		StrongMutableDictionaryPtr m_pUserDictionary; //!< Optional, shared between documents
+		MutableDictionary m_ignoreList; //!< Words accepted in this document only
+	public:
+		explicit LayeredDictionary(DictionaryHandle pBase, StrongMutableDictionaryPtr pUserDictionary = nullptr);
+
+		//! Accept a word in this document, returns false if it was already ignored.
+		bool Ignore(std::string_view word);
+		/**
+		 * Add a word to the user dictionary.
+		 *
+		 * Returns false if it was already present or there is no user dictionary.
+		 */
+		bool AddToUserDictionary(std::string_view word);
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const override;
+		//! Visits the base & user words; ignored words are never suggested.
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		//! Only counts the layers, the base is shared.
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		//! Changes with any of the layers.
+		std::uint64_t VGetGeneration(void) const noexcept override;
+		// Accessors:
+		const IDictionary &GetBase(void) const noexcept;
+		const DictionaryHandle &GetBaseHandle(void) const noexcept;
+		//! Retrieve the user dictionary (nullptr if there is none).
+		MutableDictionary *GetUserDictionary(void) const noexcept;
+		const MutableDictionary &GetIgnoreList(void) const noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_LAYEREDDICTIONARY_HPP */
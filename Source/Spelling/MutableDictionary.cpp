@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * @file   MutableDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Thread-safe word set that can grow while being checked against.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "MutableDictionary.hpp"
+
+using Lexi::MutableDictionary;
+
+MutableDictionary::MutableDictionary(void)
+	: m_words{},
+	  m_mutex{},
+	  m_generation(0)
+{
+}
+
+bool MutableDictionary::Insert(std::string_view word)
+{
+	std::unique_lock<std::shared_mutex> lock(m_mutex);
+	if (!m_words.Insert(word))
+	{
+		return false;
+	}
+
+	++m_generation;
+	return true;
+}
+
+void MutableDictionary::Clear(void)
+{
+	std::unique_lock<std::shared_mutex> lock(m_mutex);
+	m_words.Clear();
+	++m_generation;
+}
+
+bool MutableDictionary::Load(const std::filesystem::path &kPath)
+{
+	if (!std::filesystem::exists(kPath))
+	{
+		return false;
+	}
+
+	// Parse outside the lock, readers only wait for the merge.
+	const HashDictionary kWords(kPath);
+	std::unique_lock<std::shared_mutex> lock(m_mutex);
+	m_words.Reserve(m_words.VGetSize() + kWords.VGetSize());
+	kWords.VForEachWord([this](std::string_view word)
+	{
+		m_words.Insert(word);
+	});
+	++m_generation;
+
+	return true;
+}
+
+bool MutableDictionary::Reload(const std::filesystem::path &kPath)
+{
+	if (!std::filesystem::exists(kPath))
+	{
+		return false;
+	}
+
+	// Parse outside the lock, readers only wait for the swap.
+	HashDictionary words(kPath);
+	std::unique_lock<std::shared_mutex> lock(m_mutex);
+	m_words = std::move(words);
+	++m_generation;
+
+	return true;
+}
+
+void MutableDictionary::Save(const std::filesystem::path &kPath) const
+{
+	// Written next to the target & renamed over it, so the file watcher never reloads a partial file.
+	std::filesystem::path tempPath = kPath;
+	tempPath += ".tmp";
+	{
+		std::ofstream outFile(tempPath, std::ios::binary | std::ios::trunc);
+		LEXI_THROW_IF(!outFile, "Couldn't open the dictionary file for writing!");
+
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
+		m_words.VForEachWord([&outFile](std::string_view word)
+		{
+			outFile << word << '\n';
+		});
+		outFile.close();
+		LEXI_THROW_IF(!outFile, "Couldn't write the dictionary file!");
+	}
+
+	std::filesystem::rename(tempPath, kPath);
+}
+
+bool MutableDictionary::VContains(std::string_view word) const
+{
+	std::shared_lock<std::shared_mutex> lock(m_mutex);
+	return m_words.VContains(word);
+}
+
+void MutableDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	std::shared_lock<std::shared_mutex> lock(m_mutex);
+	m_words.VForEachWord(kFunc);
+}
+
+std::size_t MutableDictionary::VGetSize(void) const noexcept
+{
+	std::shared_lock<std::shared_mutex> lock(m_mutex);
+	return m_words.VGetSize();
+}
+
+std::size_t MutableDictionary::VGetMemoryUsage(void) const noexcept
+{
+	std::shared_lock<std::shared_mutex> lock(m_mutex);
+	return m_words.VGetMemoryUsage();
+}
+
+std::uint64_t MutableDictionary::VGetGeneration(void) const noexcept
+{
+	return m_generation.load();
+}
+
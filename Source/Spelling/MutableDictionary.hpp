@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * @file   MutableDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Thread-safe word set that can grow while being checked against.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_MUTABLEDICTIONARY_HPP
+#define LEXI_MUTABLEDICTIONARY_HPP
+
+namespace Lexi
+{
+	class MutableDictionary;
+	LEXI_DECLARE_PTR(MutableDictionary);
+
+	/**
+	 * Small word set that may be modified while other threads look words up.
+	 *
+	 * Used for the user dictionary & per-document ignore lists layered over
+	 * a shared, immutable dictionary. Lookups take a shared lock, so they
+	 * only wait on concurrent insertions.
+	 */
+	class MutableDictionary final : public IDictionary
+	{
+	private:
+		HashDictionary m_words;
+		mutable std::shared_mutex m_mutex; //!< Guards m_words
+		std::atomic<std::uint64_t> m_generation; //!< Bumped by every change to m_words
+	public:
+		MutableDictionary(void);
+
+		//! Insert a word, returns false if this spelling was already present.
+		bool Insert(std::string_view word);
+		void Clear(void);
+		//! Insert every word of a word list file, returns false if the file does not exist.
+		bool Load(const std::filesystem::path &kPath);
+		//! Replace the words with those of a word list file, returns false (keeping them) if it does not exist.
+		bool Reload(const std::filesystem::path &kPath);
+		//! Write the words as a plain word list (one word per line), replacing the file atomically.
+		void Save(const std::filesystem::path &kPath) const;
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const override;
+		//! kFunc must not modify this dictionary.
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		std::uint64_t VGetGeneration(void) const noexcept override;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_MUTABLEDICTIONARY_HPP */
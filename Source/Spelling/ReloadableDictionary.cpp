@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * @file   ReloadableDictionary.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Dictionary whose contents can be replaced while it is being read.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "ReloadableDictionary.hpp"
+
+using Lexi::ReloadableDictionary;
+
+ReloadableDictionary::ReloadableDictionary(UniqueIDictionaryPtr pDictionary)
+	: m_pCurrent(pDictionary.release()),
+	  m_version(0),
+	  m_publishMutex{}
+{
+	LEXI_THROW_IF(!m_pCurrent.load(), "Reloadable dictionary needs a dictionary!");
+}
+
+ReloadableDictionary::~ReloadableDictionary(void)
+{
+	delete m_pCurrent.load();
+}
+
+void ReloadableDictionary::Publish(UniqueIDictionaryPtr pDictionary)
+{
+	LEXI_THROW_IF(!pDictionary, "Cannot publish an empty dictionary!");
+
+	std::lock_guard<std::mutex> lockGuard(m_publishMutex);
+	UniqueIDictionaryPtr pPrevious(m_pCurrent.exchange(pDictionary.release(), std::memory_order_seq_cst));
+	m_version.fetch_add(1, std::memory_order_relaxed);
+	// Readers that loaded the previous pointer are still in their read sections.
+	ReadCopyUpdate::Synchronize();
+}
+
+bool ReloadableDictionary::VContains(std::string_view word) const
+{
+	ReadCopyUpdate::ReadGuard guard;
+	return m_pCurrent.load(std::memory_order_seq_cst)->VContains(word);
+}
+
+void ReloadableDictionary::VForEachWord(const WordFunc &kFunc) const
+{
+	ReadCopyUpdate::ReadGuard guard;
+	m_pCurrent.load(std::memory_order_seq_cst)->VForEachWord(kFunc);
+}
+
+std::size_t ReloadableDictionary::VGetSize(void) const noexcept
+{
+	ReadCopyUpdate::ReadGuard guard;
+	return m_pCurrent.load(std::memory_order_seq_cst)->VGetSize();
+}
+
+std::size_t ReloadableDictionary::VGetMemoryUsage(void) const noexcept
+{
+	ReadCopyUpdate::ReadGuard guard;
+	return sizeof(*this) + m_pCurrent.load(std::memory_order_seq_cst)->VGetMemoryUsage();
+}
+
+std::uint64_t ReloadableDictionary::VGetGeneration(void) const noexcept
+{
+	// The version in the high bits keeps the value increasing across versions.
+	ReadCopyUpdate::ReadGuard guard;
+	const std::uint64_t kVersion = m_version.load(std::memory_order_seq_cst);
+	return (kVersion << 32) + m_pCurrent.load(std::memory_order_seq_cst)->VGetGeneration();
+}
+
+std::uint64_t ReloadableDictionary::GetVersion(void) const noexcept
+{
+	return m_version.load(std::memory_order_relaxed);
+}
+
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * @file   ReloadableDictionary.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Dictionary whose contents can be replaced while it is being read.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_RELOADABLEDICTIONARY_HPP
+#define LEXI_RELOADABLEDICTIONARY_HPP
+
+namespace Lexi
+{
+	class ReloadableDictionary;
+	LEXI_DECLARE_PTR(ReloadableDictionary);
+
+	/**
+	 * Decorator whose wrapped dictionary can be swapped at runtime.
+	 *
+	 * Lookups read the current version through an atomic pointer inside a
+	 * ReadCopyUpdate read section, so they never take a lock or wait for a
+	 * reload. Publish() swaps in a new version and frees the old one after
+	 * the grace period.
+	 */
+	class ReloadableDictionary final : public IDictionary
+	{
+	private:
+		std::atomic<IDictionary *> m_pCurrent; //!< Owned, current version
+		std::atomic<std::uint64_t> m_version; //!< Number of versions published after the first
+		std::mutex m_publishMutex; //!< Serializes writers
+	public:
+		explicit ReloadableDictionary(UniqueIDictionaryPtr pDictionary);
+		ReloadableDictionary(const ReloadableDictionary &) = delete;
+		ReloadableDictionary &operator=(const ReloadableDictionary &) = delete;
+		~ReloadableDictionary(void);
+
+		/**
+		 * Replace the wrapped dictionary.
+		 *
+		 * Returns once no reader can still be using the previous version,
+		 * which has been freed by then.
+		 */
+		void Publish(UniqueIDictionaryPtr pDictionary);
+		//! Invoke kFunc with the current version, which stays valid until it returns.
+		template <typename Func>
+		decltype(auto) Read(Func &&func) const;
+		// IDictionary overrides:
+		bool VContains(std::string_view word) const override;
+		void VForEachWord(const WordFunc &kFunc) const override;
+		std::size_t VGetSize(void) const noexcept override;
+		std::size_t VGetMemoryUsage(void) const noexcept override;
+		//! Changes with every Publish() & with the current version's own generation.
+		std::uint64_t VGetGeneration(void) const noexcept override;
+		// Accessors:
+		std::uint64_t GetVersion(void) const noexcept;
+	};
+
+	template <typename Func>
+	inline decltype(auto) ReloadableDictionary::Read(Func &&func) const
+	{
+		ReadCopyUpdate::ReadGuard guard;
+		return func(*m_pCurrent.load(std::memory_order_seq_cst));
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_RELOADABLEDICTIONARY_HPP */
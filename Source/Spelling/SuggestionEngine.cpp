@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * @file   SuggestionEngine.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Spelling suggestions by symmetric deletion.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "SuggestionEngine.hpp"
+
+using Lexi::SuggestionEngine;
+
+template <typename Func>
+static void ForEachDeleteFrom(const char *pBuffer, std::size_t length, std::size_t start, std::uint32_t depth, Func &func)
+{
+	func(Lexi::HashDictionary::HashWord(std::string_view(pBuffer, length)));
+	if (depth == SuggestionEngine::kMAX_DISTANCE)
+	{
+		return;
+	}
+	// Deleting left to right only (from start onwards) avoids visiting the
+	// same set of deleted positions in several orders.
+	char next[SuggestionEngine::kPREFIX_LENGTH];
+	for (std::size_t index = start; index < length; ++index)
+	{
+		std::copy(pBuffer, pBuffer + index, next);
+		std::copy(pBuffer + index + 1, pBuffer + length, next + index);
+		ForEachDeleteFrom(next, length - 1, index, depth + 1, func);
+	}
+}
+
+template <typename Func>
+void SuggestionEngine::ForEachDelete(std::string_view word, Func &&func)
+{
+	const std::string_view kPrefix = word.substr(0, kPREFIX_LENGTH);
+	ForEachDeleteFrom(kPrefix.data(), kPrefix.size(), 0, 0, func);
+}
+
+SuggestionEngine::SuggestionEngine(void)
+	: m_pool{},
+	  m_wordOffsets{ 0 },
+	  m_deletes{}
+{
+}
+
+SuggestionEngine::SuggestionEngine(const IDictionary &kDictionary)
+	: SuggestionEngine()
+{
+	m_wordOffsets.reserve(kDictionary.VGetSize() + 1);
+	kDictionary.VForEachWord([this](std::string_view word)
+	{
+		if (word.empty() || word.size() > kMAX_WORD_LENGTH)
+		{
+			return;
+		}
+
+		const auto kWordIndex = static_cast<std::uint32_t>(m_wordOffsets.size() - 1);
+		m_pool.insert(m_pool.end(), word.begin(), word.end());
+		m_wordOffsets.push_back(static_cast<std::uint32_t>(m_pool.size()));
+		ForEachDelete(word, [this, kWordIndex](std::uint32_t hash)
+		{
+			m_deletes.push_back(DeleteEntry{ hash, kWordIndex });
+		});
+	});
+
+	auto toKey = [](const DeleteEntry &kEntry)
+	{
+		return std::pair(kEntry.hash, kEntry.wordIndex);
+	};
+	std::ranges::sort(m_deletes, std::less{}, toKey);
+	const auto kDuplicates = std::ranges::unique(m_deletes, std::equal_to{}, toKey);
+	m_deletes.erase(kDuplicates.begin(), kDuplicates.end());
+	m_deletes.shrink_to_fit();
+	m_pool.shrink_to_fit();
+}
+
+SuggestionEngine::Suggestions SuggestionEngine::Suggest(std::string_view word, std::size_t maxResults,
+														Microseconds budget) const
+{
+	using Clock = std::chrono::steady_clock;
+	constexpr std::size_t kCLOCK_INTERVAL = 32; //!< Candidates verified between deadline checks
+
+	const auto kDeadline = Clock::now() + budget;
+	Suggestions result{ .candidates{}, .bTimedOut = false };
+	if (word.empty() || word.size() > kMAX_WORD_LENGTH || maxResults == 0)
+	{
+		return result;
+	}
+
+	std::vector<std::uint32_t> candidates;
+	ForEachDelete(word, [this, &candidates](std::uint32_t hash)
+	{
+		const auto kRange = std::ranges::equal_range(m_deletes, hash, std::less{}, &DeleteEntry::hash);
+		for (const DeleteEntry &kEntry : kRange)
+		{
+			candidates.push_back(kEntry.wordIndex);
+		}
+	});
+	std::ranges::sort(candidates);
+	const auto kDuplicates = std::ranges::unique(candidates);
+	candidates.erase(kDuplicates.begin(), kDuplicates.end());
+
+	for (std::size_t index = 0; index < candidates.size(); ++index)
+	{
+		if (index % kCLOCK_INTERVAL == 0 && Clock::now() > kDeadline)
+		{
+			result.bTimedOut = true;
+			break;
+		}
+
+		const std::string_view kCandidate = GetWord(candidates[index]);
+		const std::uint32_t kDistance = EditDistance(word, kCandidate, kMAX_DISTANCE);
+		if (kDistance <= kMAX_DISTANCE)
+		{
+			result.candidates.push_back(Suggestion{ kCandidate, kDistance });
+		}
+	}
+
+	auto toRank = [&word](const Suggestion &kSuggestion)
+	{
+		const auto kLengthDiff = static_cast<std::ptrdiff_t>(kSuggestion.word.size()) - static_cast<std::ptrdiff_t>(word.size());
+		return std::tuple(kSuggestion.distance, (kLengthDiff < 0) ? -kLengthDiff : kLengthDiff, kSuggestion.word);
+	};
+	const std::size_t kNumResults = std::min(maxResults, result.candidates.size());
+	std::ranges::partial_sort(result.candidates, result.candidates.begin() + kNumResults, std::less{}, toRank);
+	result.candidates.resize(kNumResults);
+	return result;
+}
+
+std::size_t SuggestionEngine::GetSize(void) const noexcept
+{
+	return m_wordOffsets.size() - 1;
+}
+
+std::size_t SuggestionEngine::GetMemoryUsage(void) const noexcept
+{
+	return sizeof(*this) + m_pool.capacity() + m_wordOffsets.capacity() * sizeof(std::uint32_t) +
+		m_deletes.capacity() * sizeof(DeleteEntry);
+}
+
+std::uint32_t SuggestionEngine::EditDistance(std::string_view source, std::string_view target,
+											 std::uint32_t maxDistance) noexcept
+{
+	// A common prefix or suffix never changes the distance.
+	while (!source.empty() && !target.empty() && source.front() == target.front())
+	{
+		source.remove_prefix(1);
+		target.remove_prefix(1);
+	}
+
+	while (!source.empty() && !target.empty() && source.back() == target.back())
+	{
+		source.remove_suffix(1);
+		target.remove_suffix(1);
+	}
+
+	const std::uint32_t kOver = maxDistance + 1;
+	if (source.size() > target.size())
+	{
+		std::swap(source, target);
+	}
+
+	if (target.size() - source.size() > maxDistance || target.size() > kMAX_WORD_LENGTH)
+	{
+		return kOver;
+	}
+
+	if (source.empty())
+	{
+		return static_cast<std::uint32_t>(target.size());
+	}
+
+	std::array<std::uint32_t, kMAX_WORD_LENGTH + 1> rows[3];
+	auto *pPrevPrev = &rows[0];
+	auto *pPrev = &rows[1];
+	auto *pCurr = &rows[2];
+	for (std::size_t col = 0; col <= target.size(); ++col)
+	{
+		(*pPrev)[col] = static_cast<std::uint32_t>(col);
+	}
+
+	for (std::size_t row = 1; row <= source.size(); ++row)
+	{
+		auto &curr = *pCurr;
+		const auto &kPrev = *pPrev;
+		const auto &kPrevPrev = *pPrevPrev;
+		curr[0] = static_cast<std::uint32_t>(row);
+		std::uint32_t rowMin = curr[0];
+
+		for (std::size_t col = 1; col <= target.size(); ++col)
+		{
+			const std::uint32_t kCost = (source[row - 1] != target[col - 1]) ? 1 : 0;
+			std::uint32_t distance = std::min({ kPrev[col] + 1, curr[col - 1] + 1, kPrev[col - 1] + kCost });
+			// Adjacent transposition.
+			if (row > 1 && col > 1 && source[row - 1] == target[col - 2] && source[row - 2] == target[col - 1])
+			{
+				distance = std::min(distance, kPrevPrev[col - 2] + 1);
+			}
+
+			curr[col] = distance;
+			rowMin = std::min(rowMin, distance);
+		}
+
+		if (rowMin > maxDistance)
+		{
+			return kOver;
+		}
+
+		std::tie(pPrevPrev, pPrev, pCurr) = std::tuple(pPrev, pCurr, pPrevPrev);
+	}
+
+	return std::min((*pPrev)[target.size()], kOver);
+}
+
+std::string_view SuggestionEngine::GetWord(std::uint32_t wordIndex) const noexcept
+{
+	const std::uint32_t kStart = m_wordOffsets[wordIndex];
+	return std::string_view(m_pool.data() + kStart, m_wordOffsets[wordIndex + 1] - kStart);
+}
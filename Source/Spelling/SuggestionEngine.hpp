@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * @file   SuggestionEngine.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Spelling suggestions by symmetric deletion.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_SUGGESTIONENGINE_HPP
+#define LEXI_SUGGESTIONENGINE_HPP
+
+namespace Lexi
+{
+	class SuggestionEngine;
+	LEXI_DECLARE_PTR(SuggestionEngine);
+
+	/**
+	 * Spelling suggestions using the symmetric delete algorithm (SymSpell).
+	 *
+	 * Every dictionary word is indexed under the strings made by deleting up
+	 * to kMAX_DISTANCE characters from its prefix. A query generates the same
+	 * deletes for the misspelling, so candidates are found with hash lookups
+	 * instead of an edit distance scan over the whole dictionary.
+	 */
+	class SuggestionEngine
+	{
+	public:
+		using Microseconds = std::chrono::microseconds;
+		//! Candidate correction.
+		struct Suggestion
+		{
+			std::string_view word; //!< Points into the engine's word pool
+			std::uint32_t distance; //!< Damerau-Levenshtein (OSA) distance
+		};
+		//! Result of a query.
+		struct Suggestions
+		{
+			std::vector<Suggestion> candidates; //!< Best first
+			bool bTimedOut; //!< The time budget ran out before all candidates were checked
+		};
+
+		static constexpr std::uint32_t kMAX_DISTANCE = 2; //!< Largest edit distance suggested
+		static constexpr std::size_t kPREFIX_LENGTH = 7; //!< Characters of each word indexed
+		static constexpr std::size_t kMAX_WORD_LENGTH = 64; //!< Longer words are not indexed
+		static constexpr std::size_t kDEFAULT_MAX_RESULTS = 5;
+		static constexpr Microseconds kDEFAULT_BUDGET{ 500 };
+	private:
+		//! Index entry mapping a delete hash to a word.
+		struct DeleteEntry
+		{
+			std::uint32_t hash; //!< Hash of the delete string
+			std::uint32_t wordIndex; //!< Index into m_wordOffsets
+		};
+
+		std::vector<char> m_pool; //!< Packed word characters
+		std::vector<std::uint32_t> m_wordOffsets; //!< Start of each word in m_pool (plus end sentinel)
+		std::vector<DeleteEntry> m_deletes; //!< Sorted by hash
+	public:
+		SuggestionEngine(void);
+		//! Index every word in a dictionary.
+		explicit SuggestionEngine(const IDictionary &kDictionary);
+
+		/**
+		 * Find up to maxResults words within kMAX_DISTANCE edits of word.
+		 *
+		 * Candidates are ranked by distance, then by how close their length is,
+		 * then alphabetically. If budget runs out, the best candidates verified
+		 * so far are returned and bTimedOut is set.
+		 */
+		Suggestions Suggest(std::string_view word, std::size_t maxResults = kDEFAULT_MAX_RESULTS,
+							Microseconds budget = kDEFAULT_BUDGET) const;
+		// Accessors:
+		std::size_t GetSize(void) const noexcept;
+		std::size_t GetMemoryUsage(void) const noexcept;
+		/**
+		 * Optimal string alignment distance between two strings.
+		 *
+		 * Returns maxDistance + 1 as soon as the distance is known to exceed
+		 * maxDistance.
+		 */
+		static std::uint32_t EditDistance(std::string_view source, std::string_view target,
+										  std::uint32_t maxDistance) noexcept;
+	private:
+		std::string_view GetWord(std::uint32_t wordIndex) const noexcept;
+		//! Invoke func with the hash of every delete of word (including word itself).
+		template <typename Func>
+		static void ForEachDelete(std::string_view word, Func &&func);
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_SUGGESTIONENGINE_HPP */
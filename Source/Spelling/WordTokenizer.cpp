@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * @file   WordTokenizer.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Word boundary detection.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "WordTokenizer.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using Lexi::WordTokenizer;
+
+#if defined(__SSE2__)
+//! Mask of the ASCII letters among 16 bytes.
+static std::uint32_t GetLetterMask16(__m128i bytes) noexcept
+{
+	// Fold to lowercase, then shift 'a'..'z' onto the 26 smallest signed bytes.
+	const __m128i kFolded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+	const __m128i kShifted = _mm_add_epi8(kFolded, _mm_set1_epi8(static_cast<char>(0x80 - 'a')));
+	const __m128i kIsLetter = _mm_cmplt_epi8(kShifted, _mm_set1_epi8(static_cast<char>(-0x80 + 26)));
+	return static_cast<std::uint32_t>(_mm_movemask_epi8(kIsLetter));
+}
+#endif
+
+//! Set the bits of the letters among the non-ASCII bytes of a block.
+static std::uint64_t GetMultiByteMask(std::string_view text, std::size_t blockStart, std::size_t blockSize) noexcept
+{
+	// A block may start inside a sequence, so back up to its lead byte.
+	std::size_t offset = blockStart;
+	for (std::size_t numBack = 1; Lexi::Unicode::IsContinuationByte(text[blockStart]) &&
+		 numBack < Lexi::Unicode::kMAX_SEQUENCE_LENGTH && numBack <= blockStart; ++numBack)
+	{
+		if (!Lexi::Unicode::IsContinuationByte(text[blockStart - numBack]))
+		{
+			if (Lexi::Unicode::Decode(text.substr(blockStart - numBack)).length > numBack)
+			{
+				offset = blockStart - numBack;
+			}
+
+			break;
+		}
+	}
+
+	std::uint64_t mask = 0;
+	const std::size_t kBlockEnd = blockStart + blockSize;
+	while (offset < kBlockEnd)
+	{
+		if (Lexi::Unicode::IsAscii(text[offset]))
+		{
+			++offset; // Classified by the ASCII mask
+			continue;
+		}
+
+		const Lexi::Unicode::CodePoint kCodePoint = Lexi::Unicode::Decode(text.substr(offset));
+		if (kCodePoint.length > 1 && WordTokenizer::IsWordCodePoint(kCodePoint.value))
+		{
+			// Mark every byte of the sequence that falls inside this block.
+			const std::size_t kFirst = std::max(offset, blockStart) - blockStart;
+			const std::size_t kLast = std::min<std::size_t>(offset + kCodePoint.length, kBlockEnd) - blockStart;
+			mask |= ((kLast - kFirst == 64) ? ~std::uint64_t{ 0 } : ((std::uint64_t{ 1 } << (kLast - kFirst)) - 1)) << kFirst;
+		}
+
+		offset += kCodePoint.length;
+	}
+
+	return mask;
+}
+
+std::uint64_t WordTokenizer::GetWordCharMask(std::string_view text, std::size_t blockStart) noexcept
+{
+	const char *pBlock = text.data() + blockStart;
+	const std::size_t kSize = std::min(kBLOCK_SIZE, text.size() - blockStart);
+	std::uint64_t mask = 0;
+	std::uint64_t highMask = 0; // Bytes with the high bit set (not ASCII)
+	std::size_t index = 0;
+#if defined(__SSE2__)
+	for (; index + 16 <= kSize; index += 16)
+	{
+		const __m128i kBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pBlock + index));
+		mask |= static_cast<std::uint64_t>(GetLetterMask16(kBytes)) << index;
+		highMask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(kBytes))) << index;
+	}
+#endif
+	for (; index < kSize; ++index)
+	{
+		mask |= static_cast<std::uint64_t>(IsWordChar(pBlock[index])) << index;
+		highMask |= static_cast<std::uint64_t>(!Unicode::IsAscii(pBlock[index])) << index;
+	}
+
+	// Pure ASCII blocks (the common case) never decode anything.
+	return (highMask == 0) ? mask : (mask | GetMultiByteMask(text, blockStart, kSize));
+}
+
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * @file   WordTokenizer.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Word boundary rules for spell checking.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_WORDTOKENIZER_HPP
+#define LEXI_WORDTOKENIZER_HPP
+
+namespace Lexi
+{
+	//! Location of a word inside a larger text.
+	struct WordRange
+	{
+		std::uint32_t offset; //!< Offset of the first character
+		std::uint32_t length; //!< Number of characters
+
+		auto operator<=>(const WordRange &) const = default;
+	};
+	using WordRangeVector = std::vector<WordRange>;
+
+	/**
+	 * Word boundary rules shared by every spell checking path.
+	 *
+	 * A word is a run of UTF-8 encoded letters (see Unicode::IsLetter());
+	 * runs shorter than kMIN_WORD_LENGTH code points are never checked. Text
+	 * is classified 64 bytes at a time into a bitmask (with SSE2 where
+	 * available), word boundaries are then the set bits of mask ^ (mask << 1).
+	 * Blocks of pure ASCII never decode anything, other blocks set the bits of
+	 * every byte of a letter's sequence.
+	 */
+	class WordTokenizer
+	{
+	public:
+		static constexpr std::size_t kMIN_WORD_LENGTH = 2;
+		static constexpr std::size_t kBLOCK_SIZE = 64; //!< Bytes classified per mask
+
+		//! Determine whether or not an ASCII character can be part of a word.
+		static bool IsWordChar(char ch) noexcept;
+		//! Determine whether or not a code point can be part of a word.
+		static bool IsWordCodePoint(char32_t codePoint) noexcept;
+		//! Determine whether or not a complete run of word characters should be checked.
+		static bool IsCheckable(std::string_view word) noexcept;
+		/**
+		 * Bit i is set if text[blockStart + i] belongs to a word character,
+		 * for the (up to) kBLOCK_SIZE bytes starting at blockStart.
+		 */
+		static std::uint64_t GetWordCharMask(std::string_view text, std::size_t blockStart) noexcept;
+		/**
+		 * Invoke func(WordRange) for every maximal run of word characters,
+		 * including runs too short to check.
+		 */
+		template <typename Func>
+		static void ForEachRun(std::string_view text, Func &&func);
+		//! Invoke func(WordRange) for every checkable word in text.
+		template <typename Func>
+		static void ForEachWord(std::string_view text, Func &&func);
+	};
+
+	inline bool WordTokenizer::IsWordChar(char ch) noexcept
+	{
+		// Same as std::isalpha in the "C" locale, without the locale lookup.
+		return static_cast<unsigned char>((static_cast<unsigned char>(ch) | 0x20) - 'a') < 26;
+	}
+
+	inline bool WordTokenizer::IsWordCodePoint(char32_t codePoint) noexcept
+	{
+		return Unicode::IsLetter(codePoint);
+	}
+
+	inline bool WordTokenizer::IsCheckable(std::string_view word) noexcept
+	{
+		// Only count code points when the byte length can't decide.
+		if (word.size() < kMIN_WORD_LENGTH)
+		{
+			return false;
+		}
+		else if (word.size() >= kMIN_WORD_LENGTH * Unicode::kMAX_SEQUENCE_LENGTH)
+		{
+			return true;
+		}
+
+		return Unicode::CountCodePoints(word) >= kMIN_WORD_LENGTH;
+	}
+
+	template <typename Func>
+	inline void WordTokenizer::ForEachRun(std::string_view text, Func &&func)
+	{
+		std::size_t runStart = 0;
+		bool bInRun = false;
+		for (std::size_t blockStart = 0; blockStart < text.size(); blockStart += kBLOCK_SIZE)
+		{
+			const std::uint64_t kMask = GetWordCharMask(text, blockStart);
+			// A set bit marks a change between word & non-word characters (bits past the text are clear).
+			std::uint64_t edges = kMask ^ ((kMask << 1) | (bInRun ? 1 : 0));
+			while (edges != 0)
+			{
+				const std::size_t kPos = blockStart + static_cast<std::size_t>(std::countr_zero(edges));
+				edges &= edges - 1;
+				if (!bInRun)
+				{
+					runStart = kPos;
+				}
+				else
+				{
+					func(WordRange{ static_cast<std::uint32_t>(runStart), static_cast<std::uint32_t>(kPos - runStart) });
+				}
+
+				bInRun = !bInRun;
+			}
+		}
+
+		if (bInRun)
+		{
+			func(WordRange{ static_cast<std::uint32_t>(runStart), static_cast<std::uint32_t>(text.size() - runStart) });
+		}
+	}
+
+	template <typename Func>
+	inline void WordTokenizer::ForEachWord(std::string_view text, Func &&func)
+	{
+		ForEachRun(text, [text, &func](const WordRange &kRange)
+		{
+			if (IsCheckable(text.substr(kRange.offset, kRange.length)))
+			{
+				func(kRange);
+			}
+		});
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_WORDTOKENIZER_HPP */
@@ -42,8 +42,15 @@ std::unordered_map<std::string_view, Config::OperatingSystem> Config::s_systems
 	{ "MacOS", Config::OperatingSystem::kMacOS },
 	{ "FreeBSD", Config::OperatingSystem::kFreeBSD },
 };
+std::unordered_map<std::string_view, Config::DictionaryStorage> Config::s_dictStorages = {
+	{ "Hash", Config::DictionaryStorage::kHash },
+	{ "Dawg", Config::DictionaryStorage::kDawg },
+};
 
 Config::Config(void)
+	: m_app{},
+	  m_user{ .bAutoSave = false, .wordDictPath{}, .wordDictStorage = DictionaryStorage::kHash,
+			  .bWordDictFilter = false, .userDictPath{}, .bHotReload = false }
 {
 }
 
@@ -84,6 +91,19 @@ void Config::Load(XMLElement *pRoot)
 		else if (kName == "WordDict")
 		{
 			m_user.wordDictPath = pNode->GetText();
+			if (const char *pStorage = pNode->Attribute("storage"))
+			{
+				m_user.wordDictStorage = StringToDictionaryStorage(pStorage);
+			}
+			m_user.bWordDictFilter = pNode->BoolAttribute("filter", false);
+		}
+		else if (kName == "UserDict")
+		{
+			m_user.userDictPath = pNode->GetText();
+		}
+		else if (kName == "HotReload")
+		{
+			m_user.bHotReload = pNode->BoolAttribute("value");
 		}
 	}
 }
@@ -128,3 +148,17 @@ Config::OperatingSystem Config::StringToOperatingSystem(std::string_view system)
 	}
 }
 
+Config::DictionaryStorage Config::StringToDictionaryStorage(std::string_view storage)
+{
+	auto iter = s_dictStorages.find(storage);
+
+	if (iter != s_dictStorages.end())
+	{
+		return iter->second;
+	}
+	else
+	{
+		LEXI_THROW("Unsupported word dictionary storage!");
+	}
+}
+
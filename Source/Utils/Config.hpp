@@ -49,6 +49,12 @@ namespace Lexi
 			kMacOS,
 			kFreeBSD
 		};
+		//! In-memory representation of the word dictionary.
+		enum struct DictionaryStorage
+		{
+			kHash, /**< Hash table, fastest lookups */
+			kDawg /**< Minimized word graph, smallest footprint */
+		};
 		//! Configuration options set by distributor.
 		struct App
 		{
@@ -62,11 +68,16 @@ namespace Lexi
 		{
 			bool bAutoSave;
 			std::string wordDictPath;
+			DictionaryStorage wordDictStorage;
+			bool bWordDictFilter; //!< Put a Bloom filter in front of the dictionary
+			std::string userDictPath; //!< Words added by the user (empty disables saving)
+			bool bHotReload; //!< Reload dictionaries when their files change
 		};
 	private:
 		static UniqueConfigPtr s_pInstance; //!< Singleton instance
 		static std::mutex s_mutex;
 		static std::unordered_map<std::string_view, OperatingSystem> s_systems;
+		static std::unordered_map<std::string_view, DictionaryStorage> s_dictStorages;
 
 		App m_app; //!< Application settings
 		User m_user; //!< User settings
@@ -81,11 +92,13 @@ namespace Lexi
 		const App &GetApp(void) const noexcept;
 		const User &GetUser(void) const noexcept;
 		static constexpr std::string_view OperatingSystemToString(OperatingSystem system) noexcept;
+		static constexpr std::string_view DictionaryStorageToString(DictionaryStorage storage) noexcept;
 	private:
 		// Hide constructor so instances cannot be created directly.
 		Config(void);
 
 		static OperatingSystem StringToOperatingSystem(std::string_view system);
+		static DictionaryStorage StringToDictionaryStorage(std::string_view storage);
 	};
 
 	inline constexpr std::string_view Config::OperatingSystemToString(OperatingSystem system) noexcept
@@ -106,6 +119,21 @@ namespace Lexi
 			return "Unknown";
 		}
 	}
+
+	inline constexpr std::string_view Config::DictionaryStorageToString(DictionaryStorage storage) noexcept
+	{
+		using enum DictionaryStorage;
+
+		switch (storage)
+		{
+		case kHash:
+			return "Hash";
+		case kDawg:
+			return "Dawg";
+		default:
+			return "Unknown";
+		}
+	}
 } // End namespace (Lexi)
 
 #endif /* !LEXI_CONFIG_HPP */
@@ -62,12 +62,13 @@ namespace Lexi
 } // End namespace (Lexi)
 
 // __FUNCTION__ is non-standard; use __func__.  __FILE__ & __LINE__
+// Locals are named so they cannot shadow names used in MSG (e.g. kPath).
 #define LEXI_THROW(MSG) \
 do \
 { \
 	const auto kSourceLoc = std::source_location::current(); \
-	std::filesystem::path kPath(kSourceLoc.file_name()); \
-	throw Lexi::Exception(MSG, kPath.filename().string(), kSourceLoc.function_name(), kSourceLoc.line()); \
+	std::filesystem::path kThrowPath(kSourceLoc.file_name()); \
+	throw Lexi::Exception(MSG, kThrowPath.filename().string(), kSourceLoc.function_name(), kSourceLoc.line()); \
 } \
 while (0) \
 
@@ -77,8 +78,8 @@ do \
 	if (COND) \
 	{ \
 		const auto kSourceLoc = std::source_location::current(); \
-		std::filesystem::path kPath(kSourceLoc.file_name()); \
-		throw Lexi::Exception(MSG, kPath.filename().string(), kSourceLoc.function_name(), kSourceLoc.line()); \
+		std::filesystem::path kThrowPath(kSourceLoc.file_name()); \
+		throw Lexi::Exception(MSG, kThrowPath.filename().string(), kSourceLoc.function_name(), kSourceLoc.line()); \
 	} \
 } \
 while (0) \
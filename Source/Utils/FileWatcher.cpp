@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * @file   FileWatcher.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Notifies about changes to watched files.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "FileWatcher.hpp"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using Lexi::FileWatcher;
+
+FileWatcher::FileWatcher(ChangeFunc changeFunc)
+	: m_changeFunc(std::move(changeFunc)),
+	  m_notifyFd(-1),
+	  m_stopFd(-1),
+	  m_mutex{},
+	  m_directories{},
+	  m_files{},
+	  m_thread{}
+{
+#if defined(__linux__)
+	m_notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	LEXI_THROW_IF(m_notifyFd < 0, "Couldn't create the inotify instance!");
+	m_stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (m_stopFd < 0)
+	{
+		close(m_notifyFd);
+		LEXI_THROW("Couldn't create the watcher stop event!");
+	}
+
+	m_thread = std::thread(&FileWatcher::WatcherMain, this);
+#endif
+}
+
+FileWatcher::~FileWatcher(void)
+{
+#if defined(__linux__)
+	const std::uint64_t kSignal = 1;
+	[[maybe_unused]] const auto kNumWritten = write(m_stopFd, &kSignal, sizeof(kSignal));
+	m_thread.join();
+	close(m_stopFd);
+	close(m_notifyFd);
+#endif
+}
+
+bool FileWatcher::Watch(const std::filesystem::path &kPath)
+{
+#if defined(__linux__)
+	const std::filesystem::path kFilePath = std::filesystem::absolute(kPath).lexically_normal();
+	const std::filesystem::path kDirectory = kFilePath.parent_path();
+	const int kWatch = inotify_add_watch(m_notifyFd, kDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+	LEXI_THROW_IF(kWatch < 0, "Couldn't watch the directory of a file!");
+
+	std::lock_guard<std::mutex> lockGuard(m_mutex);
+	// The same directory yields the same descriptor.
+	m_directories[kWatch] = kDirectory;
+	if (std::ranges::find(m_files, kFilePath) == m_files.end())
+	{
+		m_files.push_back(kFilePath);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void FileWatcher::WatcherMain(void)
+{
+#if defined(__linux__)
+	alignas(inotify_event) char buffer[4096];
+	std::vector<std::filesystem::path> changedFiles;
+	std::chrono::steady_clock::time_point settleTime;
+	pollfd pollFds[2] = {
+		{ .fd = m_notifyFd, .events = POLLIN, .revents = 0 },
+		{ .fd = m_stopFd, .events = POLLIN, .revents = 0 },
+	};
+
+	while (true)
+	{
+		// Block until the first event, then wait for the burst to settle.
+		int timeout = -1;
+		if (!changedFiles.empty())
+		{
+			const auto kRemaining = settleTime - std::chrono::steady_clock::now();
+			timeout = static_cast<int>(std::max<int64_t>(std::chrono::ceil<std::chrono::milliseconds>(kRemaining).count(), 0));
+		}
+
+		const int kNumReady = poll(pollFds, 2, timeout);
+		if (kNumReady < 0 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (kNumReady < 0 || (pollFds[1].revents & POLLIN))
+		{
+			break;
+		}
+
+		// Unrelated files in a watched directory mustn't hold back the callbacks.
+		if (!changedFiles.empty() && std::chrono::steady_clock::now() >= settleTime)
+		{
+			for (const auto &kPath : changedFiles)
+			{
+				try
+				{
+					m_changeFunc(kPath);
+				}
+				catch (const Exception &kExcept)
+				{
+					LEXI_ERR("File change handler failed({}:{}): {}", kExcept.GetFilename(), kExcept.GetLineNum(),
+							 kExcept.VWhat());
+				}
+				catch (const std::exception &kExcept)
+				{
+					LEXI_ERR("File change handler failed: {}", kExcept.what());
+				}
+			}
+
+			changedFiles.clear();
+			continue;
+		}
+
+		ssize_t numBytes = 0;
+		while ((numBytes = read(m_notifyFd, buffer, sizeof(buffer))) > 0)
+		{
+			std::lock_guard<std::mutex> lockGuard(m_mutex);
+			for (const char *pEvent = buffer; pEvent < buffer + numBytes;)
+			{
+				const auto *pNotify = reinterpret_cast<const inotify_event *>(pEvent);
+				pEvent += sizeof(inotify_event) + pNotify->len;
+
+				const auto kIter = m_directories.find(pNotify->wd);
+				if (pNotify->len == 0 || kIter == m_directories.end())
+				{
+					continue;
+				}
+
+				const std::filesystem::path kPath = kIter->second / pNotify->name;
+				if (std::ranges::find(m_files, kPath) == m_files.end())
+				{
+					continue;
+				}
+
+				settleTime = std::chrono::steady_clock::now() + kSETTLE_TIME;
+				if (std::ranges::find(changedFiles, kPath) == changedFiles.end())
+				{
+					changedFiles.push_back(kPath);
+				}
+			}
+		}
+	}
+#endif
+}
+
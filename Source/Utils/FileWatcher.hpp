@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * @file   FileWatcher.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Notifies about changes to watched files.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_FILEWATCHER_HPP
+#define LEXI_FILEWATCHER_HPP
+
+namespace Lexi
+{
+	class FileWatcher;
+	LEXI_DECLARE_PTR(FileWatcher);
+
+	/**
+	 * Watches files for changes on a thread of its own (inotify on Linux).
+	 *
+	 * The directory of each file is watched, so files replaced by renaming a
+	 * new one over them are noticed too. Bursts of events are coalesced: the
+	 * callback runs once per changed file after no watched file changed for
+	 * kSETTLE_TIME. Other files in the same directories don't delay it.
+	 */
+	class FileWatcher final : public INonCopyable
+	{
+	public:
+		using ChangeFunc = std::function<void (const std::filesystem::path &kPath)>;
+
+		static constexpr std::chrono::milliseconds kSETTLE_TIME{ 100 };
+	private:
+		ChangeFunc m_changeFunc; //!< Invoked on the watcher thread
+		int m_notifyFd; //!< inotify instance
+		int m_stopFd; //!< Signalled to stop the thread
+		std::mutex m_mutex; //!< Guards m_directories & m_files
+		std::unordered_map<int, std::filesystem::path> m_directories; //!< Watched directories by descriptor
+		std::vector<std::filesystem::path> m_files; //!< Watched files
+		std::thread m_thread;
+	public:
+		explicit FileWatcher(ChangeFunc changeFunc);
+		//! Stop watching & join the thread.
+		~FileWatcher(void);
+
+		//! Start watching a file, returns false if file watching is unsupported.
+		bool Watch(const std::filesystem::path &kPath);
+		// Accessors:
+		static constexpr bool IsSupported(void) noexcept;
+	private:
+		void WatcherMain(void);
+	};
+
+	inline constexpr bool FileWatcher::IsSupported(void) noexcept
+	{
+#if defined(__linux__)
+		return true;
+#else
+		return false;
+#endif
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_FILEWATCHER_HPP */
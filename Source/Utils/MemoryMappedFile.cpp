@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * @file   MemoryMappedFile.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Read-only memory-mapped file.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "MemoryMappedFile.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LEXI_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using Lexi::MemoryMappedFile;
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path &kPath)
+	: m_pData(nullptr),
+	  m_size(0),
+	  m_buffer{}
+{
+#if defined(LEXI_HAS_MMAP)
+	const int kFd = ::open(kPath.c_str(), O_RDONLY);
+	LEXI_THROW_IF(kFd < 0, std::format("Couldn't open '{}'!", kPath.string()));
+
+	struct stat fileStat{};
+	if (::fstat(kFd, &fileStat) != 0)
+	{
+		::close(kFd);
+		LEXI_THROW(std::format("Couldn't stat '{}'!", kPath.string()));
+	}
+
+	m_size = static_cast<std::size_t>(fileStat.st_size);
+	if (m_size > 0)
+	{
+		void *pMapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, kFd, 0);
+		::close(kFd);
+		LEXI_THROW_IF(pMapping == MAP_FAILED, std::format("Couldn't map '{}'!", kPath.string()));
+		m_pData = static_cast<const char *>(pMapping);
+	}
+	else
+	{
+		::close(kFd);
+	}
+#else
+	std::ifstream inFile(kPath, std::ios::binary);
+	LEXI_THROW_IF(!inFile, std::format("Couldn't open '{}'!", kPath.string()));
+	m_buffer.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+	m_pData = m_buffer.data();
+	m_size = m_buffer.size();
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile(void)
+{
+#if defined(LEXI_HAS_MMAP)
+	if (m_pData)
+	{
+		::munmap(const_cast<char *>(m_pData), m_size);
+	}
+#endif
+}
+
+const char *MemoryMappedFile::GetData(void) const noexcept
+{
+	return m_pData;
+}
+
+std::size_t MemoryMappedFile::GetSize(void) const noexcept
+{
+	return m_size;
+}
+
+std::span<const char> MemoryMappedFile::GetBytes(void) const noexcept
+{
+	return std::span<const char>(m_pData, m_size);
+}
+
+std::string_view MemoryMappedFile::GetText(void) const noexcept
+{
+	return std::string_view(m_pData, m_size);
+}
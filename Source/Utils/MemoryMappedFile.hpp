@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * @file   MemoryMappedFile.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Read-only memory-mapped file.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_MEMORYMAPPEDFILE_HPP
+#define LEXI_MEMORYMAPPEDFILE_HPP
+
+namespace Lexi
+{
+	class MemoryMappedFile;
+	LEXI_DECLARE_PTR(MemoryMappedFile);
+
+	/**
+	 * Read-only view of a whole file.
+	 *
+	 * Uses mmap where available, otherwise the file is read into memory.
+	 */
+	class MemoryMappedFile final : public INonCopyable
+	{
+		const char *m_pData; //!< Start of the mapped bytes
+		std::size_t m_size; //!< Number of mapped bytes
+		std::vector<char> m_buffer; //!< Fallback storage when mapping is unavailable
+	public:
+		//! Map a file, throws if it cannot be opened.
+		explicit MemoryMappedFile(const std::filesystem::path &kPath);
+		~MemoryMappedFile(void);
+		// Accessors:
+		const char *GetData(void) const noexcept;
+		std::size_t GetSize(void) const noexcept;
+		std::span<const char> GetBytes(void) const noexcept;
+		std::string_view GetText(void) const noexcept;
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_MEMORYMAPPEDFILE_HPP */
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file   ReadCopyUpdate.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Epoch-based read-copy-update for lock-free readers.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "ReadCopyUpdate.hpp"
+
+using Lexi::ReadCopyUpdate;
+
+namespace
+{
+	constexpr std::uint64_t kIDLE_EPOCH = std::numeric_limits<std::uint64_t>::max();
+
+	//! Epoch of the read section a thread is in, padded so readers do not share cache lines.
+	struct alignas(64) ReaderSlot
+	{
+		std::atomic<std::uint64_t> epoch{ kIDLE_EPOCH };
+		std::atomic<bool> bClaimed{ false };
+	};
+
+	ReaderSlot s_slots[ReadCopyUpdate::kMAX_READER_THREADS];
+	std::atomic<std::uint64_t> s_epoch{ 0 }; //!< Advanced by every grace period
+	std::atomic<std::size_t> s_numSharedReaders{ 0 }; //!< Readers in a section without a slot
+
+	//! Per-thread reader state, releases the slot when the thread exits.
+	struct ThreadReader
+	{
+		ReaderSlot *pSlot = nullptr;
+		std::uint32_t depth = 0; //!< Nesting level of read sections
+		bool bTriedClaim = false;
+
+		~ThreadReader(void)
+		{
+			if (pSlot)
+			{
+				pSlot->bClaimed.store(false, std::memory_order_release);
+			}
+		}
+
+		ReaderSlot *GetSlot(void) noexcept
+		{
+			if (!bTriedClaim)
+			{
+				bTriedClaim = true;
+				for (auto &slot : s_slots)
+				{
+					bool bClaimed = false;
+					if (slot.bClaimed.compare_exchange_strong(bClaimed, true, std::memory_order_acquire))
+					{
+						pSlot = &slot;
+						break;
+					}
+				}
+			}
+
+			return pSlot;
+		}
+	};
+
+	thread_local ThreadReader s_reader;
+} // End anonymous namespace
+
+ReadCopyUpdate::ReadGuard::ReadGuard(void) noexcept
+{
+	ThreadReader &reader = s_reader;
+	if (reader.depth++ > 0)
+	{
+		return;
+	}
+	// Sequentially consistent, so a writer that swapped after this either sees the slot or the reader sees the swap.
+	if (ReaderSlot *pSlot = reader.GetSlot())
+	{
+		pSlot->epoch.store(s_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+	}
+	else
+	{
+		s_numSharedReaders.fetch_add(1, std::memory_order_seq_cst);
+	}
+}
+
+ReadCopyUpdate::ReadGuard::~ReadGuard(void)
+{
+	ThreadReader &reader = s_reader;
+	if (--reader.depth > 0)
+	{
+		return;
+	}
+
+	if (reader.pSlot)
+	{
+		reader.pSlot->epoch.store(kIDLE_EPOCH, std::memory_order_release);
+	}
+	else
+	{
+		s_numSharedReaders.fetch_sub(1, std::memory_order_release);
+	}
+}
+
+void ReadCopyUpdate::Synchronize(void)
+{
+	LEXI_THROW_IF(s_reader.depth > 0, "Cannot wait for a grace period inside a read section!");
+
+	// Sections entered from now on publish this epoch (or a later one) and never see the old object.
+	const std::uint64_t kEpoch = s_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+	for (const auto &kSlot : s_slots)
+	{
+		while (kSlot.epoch.load(std::memory_order_seq_cst) < kEpoch)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	while (s_numSharedReaders.load(std::memory_order_seq_cst) > 0)
+	{
+		std::this_thread::yield();
+	}
+}
+
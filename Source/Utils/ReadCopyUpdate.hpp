@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * @file   ReadCopyUpdate.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Epoch-based read-copy-update for lock-free readers.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_READCOPYUPDATE_HPP
+#define LEXI_READCOPYUPDATE_HPP
+
+namespace Lexi
+{
+	/**
+	 * Read-copy-update grace periods.
+	 *
+	 * Readers wrap their accesses to a shared object in a ReadGuard, which
+	 * never blocks: it only publishes the current epoch in a per-thread slot.
+	 * A writer swaps in a new object, then calls Synchronize() to wait until
+	 * every reader that might still see the old one has left its read section
+	 * before freeing it.
+	 */
+	class ReadCopyUpdate final
+	{
+	public:
+		//! Threads with their own reader slot, others share a counter (and delay writers longer).
+		static constexpr std::size_t kMAX_READER_THREADS = 64;
+
+		//! Read section, may be nested.
+		class ReadGuard final
+		{
+		public:
+			ReadGuard(void) noexcept;
+			ReadGuard(const ReadGuard &) = delete;
+			ReadGuard &operator=(const ReadGuard &) = delete;
+			~ReadGuard(void);
+		};
+
+		ReadCopyUpdate(void) = delete;
+		/**
+		 * Wait until every read section that started before the call has ended.
+		 *
+		 * Must not be called from within a read section.
+		 */
+		static void Synchronize(void);
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_READCOPYUPDATE_HPP */
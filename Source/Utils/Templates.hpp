@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * @file   Templates.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Template helpers.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_TEMPLATES_HPP
+#define LEXI_TEMPLATES_HPP
+
+namespace Lexi
+{
+	/**
+	 * Base for statically polymorphic classes (curiously recurring template pattern).
+	 *
+	 * Calls made through GetDerived() are resolved at compile time, so they
+	 * can be inlined where a virtual call could not.
+	 */
+	template <typename Derived>
+	class Crtp
+	{
+	protected:
+		Derived &GetDerived(void) noexcept;
+		const Derived &GetDerived(void) const noexcept;
+	};
+
+	template <typename Derived>
+	inline Derived &Crtp<Derived>::GetDerived(void) noexcept
+	{
+		return static_cast<Derived &>(*this);
+	}
+
+	template <typename Derived>
+	inline const Derived &Crtp<Derived>::GetDerived(void) const noexcept
+	{
+		return static_cast<const Derived &>(*this);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_TEMPLATES_HPP */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * @file   ThreadPool.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Work-stealing thread pool.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "ThreadPool.hpp"
+
+using Lexi::ThreadPool;
+
+//! Pool & queue index of the calling thread when it is a worker.
+static thread_local const ThreadPool *s_pWorkerPool = nullptr;
+static thread_local std::size_t s_workerIndex = 0;
+
+ThreadPool::ThreadPool(std::size_t numThreads)
+	: m_queues{},
+	  m_threads{},
+	  m_sleepMutex{},
+	  m_wakeCondition{},
+	  m_numQueued(0),
+	  m_nextQueue(0),
+	  m_bStopping(false)
+{
+	if (numThreads == 0)
+	{
+		numThreads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	m_queues.reserve(numThreads);
+	for (std::size_t index = 0; index < numThreads; ++index)
+	{
+		m_queues.push_back(std::make_unique<WorkQueue>());
+	}
+
+	m_threads.reserve(numThreads);
+	for (std::size_t index = 0; index < numThreads; ++index)
+	{
+		m_threads.emplace_back(&ThreadPool::WorkerMain, this, index);
+	}
+}
+
+ThreadPool::~ThreadPool(void)
+{
+	{
+		std::lock_guard lock(m_sleepMutex);
+		m_bStopping = true;
+	}
+
+	m_wakeCondition.notify_all();
+	for (auto &thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void ThreadPool::Submit(Task task)
+{
+	const bool kbFromWorker = s_pWorkerPool == this;
+	const std::size_t kQueueIndex = kbFromWorker ? s_workerIndex
+												 : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+	{
+		auto &queue = *m_queues[kQueueIndex];
+		std::lock_guard lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+	}
+	{
+		// Counted under the sleep mutex so a worker can't miss the wake-up.
+		std::lock_guard lock(m_sleepMutex);
+		m_numQueued.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	m_wakeCondition.notify_one();
+}
+
+std::size_t ThreadPool::GetNumThreads(void) const noexcept
+{
+	return m_threads.size();
+}
+
+void ThreadPool::WorkerMain(std::size_t workerIndex)
+{
+	s_pWorkerPool = this;
+	s_workerIndex = workerIndex;
+
+	Task task;
+	while (true)
+	{
+		if (TryTakeTask(workerIndex, task))
+		{
+			m_numQueued.fetch_sub(1, std::memory_order_relaxed);
+			try
+			{
+				task();
+			}
+			catch (const Exception &kExcept)
+			{
+				LEXI_ERR("Task failed({}:{}): {}", kExcept.GetFilename(), kExcept.GetLineNum(), kExcept.VWhat());
+			}
+			catch (const std::exception &kExcept)
+			{
+				LEXI_ERR("Task failed: {}", kExcept.what());
+			}
+
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock lock(m_sleepMutex);
+		m_wakeCondition.wait(lock, [this]()
+		{
+			return m_bStopping || m_numQueued.load(std::memory_order_relaxed) > 0;
+		});
+		// Queued work is still finished when stopping.
+		if (m_bStopping && m_numQueued.load(std::memory_order_relaxed) <= 0)
+		{
+			break;
+		}
+	}
+}
+
+bool ThreadPool::TryTakeTask(std::size_t workerIndex, Task &task)
+{
+	{
+		auto &queue = *m_queues[workerIndex];
+		std::lock_guard lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+			return true;
+		}
+	}
+
+	for (std::size_t offset = 1; offset < m_queues.size(); ++offset)
+	{
+		auto &victim = *m_queues[(workerIndex + offset) % m_queues.size()];
+		std::lock_guard lock(victim.mutex);
+		if (!victim.tasks.empty())
+		{
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
+
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * @file   ThreadPool.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Work-stealing thread pool.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_THREADPOOL_HPP
+#define LEXI_THREADPOOL_HPP
+
+namespace Lexi
+{
+	class ThreadPool;
+	LEXI_DECLARE_PTR(ThreadPool);
+
+	/**
+	 * Fixed-size pool of worker threads with one task queue per worker.
+	 *
+	 * A worker takes its newest task first (tasks it submits land on its own
+	 * queue) and, when that queue is empty, steals the oldest task of another
+	 * worker. Tasks submitted from outside the pool are spread round-robin.
+	 */
+	class ThreadPool final : public INonCopyable
+	{
+	public:
+		using Task = std::function<void (void)>;
+	private:
+		//! Task queue owned by one worker, padded so queues do not share cache lines.
+		struct alignas(64) WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> m_queues; //!< One queue per worker
+		std::vector<std::thread> m_threads;
+		std::mutex m_sleepMutex; //!< Guards sleeping & m_bStopping
+		std::condition_variable m_wakeCondition;
+		std::atomic<std::ptrdiff_t> m_numQueued; //!< Tasks in all queues (briefly negative while racing)
+		std::atomic<std::size_t> m_nextQueue; //!< Round-robin index for outside submissions
+		bool m_bStopping;
+	public:
+		//! Start numThreads workers, zero uses the hardware concurrency.
+		explicit ThreadPool(std::size_t numThreads = 0);
+		//! Finish queued tasks & join the workers.
+		~ThreadPool(void);
+
+		void Submit(Task task);
+		// Accessors:
+		std::size_t GetNumThreads(void) const noexcept;
+	private:
+		void WorkerMain(std::size_t workerIndex);
+		//! Pop from the worker's own queue or steal from another one.
+		bool TryTakeTask(std::size_t workerIndex, Task &task);
+	};
+} // End namespace (Lexi)
+
+#endif /* !LEXI_THREADPOOL_HPP */
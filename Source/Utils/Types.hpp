@@ -33,9 +33,17 @@
 
 namespace Lexi
 {
-	// TOD: Implement Point & Rect classes.
-	class Point;
+	// TODO: Implement the Rect class.
 	class Rect;
+	//! Position in window coordinates (pixels).
+	class Point
+	{
+	public:
+		std::int32_t x;
+		std::int32_t y;
+
+		auto operator<=>(const Point &) const = default;
+	};
 } // End namespace (Lexi)
 
 #endif /* !LEXI_TYPES_HPP */
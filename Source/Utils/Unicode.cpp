@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * @file   Unicode.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  UTF-8 decoding & code point classification.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+#include "Unicode.hpp"
+#include "UnicodeTables.ipp"
+
+using Lexi::Unicode;
+
+Unicode::CodePoint Unicode::Decode(std::string_view text) noexcept
+{
+	constexpr CodePoint kINVALID{ kREPLACEMENT_CHAR, 1 };
+	// Smallest code point that needs a sequence of each length (shorter encodings are overlong).
+	constexpr char32_t kMIN_VALUES[] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+	if (text.empty())
+	{
+		return kINVALID;
+	}
+
+	const std::size_t kLength = GetSequenceLength(text.front());
+	if (kLength == 1)
+	{
+		return CodePoint{ static_cast<char32_t>(text.front()), 1 };
+	}
+	else if (kLength == 0 || kLength > text.size())
+	{
+		return kINVALID;
+	}
+
+	// Payload bits of the lead byte, then six bits per continuation byte.
+	char32_t value = static_cast<unsigned char>(text.front()) & (0x7F >> kLength);
+	for (std::size_t index = 1; index < kLength; ++index)
+	{
+		if (!IsContinuationByte(text[index]))
+		{
+			return kINVALID;
+		}
+
+		value = (value << 6) | (static_cast<unsigned char>(text[index]) & 0x3F);
+	}
+
+	if (value < kMIN_VALUES[kLength] || value > 0x10FFFF || (value >= 0xD800 && value < 0xE000))
+	{
+		return kINVALID;
+	}
+
+	return CodePoint{ value, static_cast<std::uint8_t>(kLength) };
+}
+
+std::size_t Unicode::Encode(char32_t codePoint, char *pOutput) noexcept
+{
+	if (codePoint < 0x80)
+	{
+		pOutput[0] = static_cast<char>(codePoint);
+		return 1;
+	}
+	else if (codePoint < 0x800)
+	{
+		pOutput[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+		pOutput[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	else if (codePoint < 0x10000)
+	{
+		pOutput[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+		pOutput[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		pOutput[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+
+	pOutput[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+	pOutput[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+	pOutput[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+	pOutput[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+	return 4;
+}
+
+std::size_t Unicode::CountCodePoints(std::string_view text) noexcept
+{
+	std::size_t numCodePoints = 0;
+	while (!text.empty())
+	{
+		text.remove_prefix(Decode(text).length);
+		++numCodePoints;
+	}
+
+	return numCodePoints;
+}
+
+bool Unicode::IsLetterTable(char32_t codePoint) noexcept
+{
+	const char32_t kBlock = codePoint >> 8;
+	if (kBlock >= kNUM_LETTER_BLOCKS)
+	{
+		return false;
+	}
+
+	const std::size_t kBitIndex = codePoint & 0xFF;
+	const std::uint64_t kWord = kLETTER_BITS[kLETTER_BLOCK_INDEX[kBlock] * 4 + kBitIndex / 64];
+	return (kWord >> (kBitIndex % 64)) & 1;
+}
+
+char32_t Unicode::ToLowerTable(char32_t codePoint) noexcept
+{
+	if (codePoint - kLATIN_FIRST_A < std::size(kLATIN_LOWER_A))
+	{
+		return kLATIN_LOWER_A[codePoint - kLATIN_FIRST_A];
+	}
+	else if (codePoint - kLATIN_FIRST_B < std::size(kLATIN_LOWER_B))
+	{
+		return kLATIN_LOWER_B[codePoint - kLATIN_FIRST_B];
+	}
+
+	return codePoint;
+}
+
+char32_t Unicode::ToUpperTable(char32_t codePoint) noexcept
+{
+	if (codePoint - kLATIN_FIRST_A < std::size(kLATIN_UPPER_A))
+	{
+		return kLATIN_UPPER_A[codePoint - kLATIN_FIRST_A];
+	}
+	else if (codePoint - kLATIN_FIRST_B < std::size(kLATIN_UPPER_B))
+	{
+		return kLATIN_UPPER_B[codePoint - kLATIN_FIRST_B];
+	}
+
+	return codePoint;
+}
+
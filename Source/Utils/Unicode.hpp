@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * @file   Unicode.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  UTF-8 decoding & code point classification.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_UNICODE_HPP
+#define LEXI_UNICODE_HPP
+
+namespace Lexi
+{
+	/**
+	 * UTF-8 decoding & the character classes the spell checker needs.
+	 *
+	 * Classification uses compact two-stage tables generated from the Unicode
+	 * Character Database (see Tools/GenerateUnicodeTables.py). ASCII is
+	 * answered inline without touching the tables.
+	 */
+	class Unicode
+	{
+	public:
+		static constexpr char32_t kREPLACEMENT_CHAR = 0xFFFD;
+		static constexpr std::size_t kMAX_SEQUENCE_LENGTH = 4;
+
+		//! A decoded code point & the number of bytes it was encoded in.
+		struct CodePoint
+		{
+			char32_t value;
+			std::uint8_t length;
+		};
+
+		static bool IsAscii(char ch) noexcept;
+		static bool IsContinuationByte(char ch) noexcept;
+		//! Length of the sequence a lead byte starts (zero for continuation & invalid bytes).
+		static std::size_t GetSequenceLength(char lead) noexcept;
+		/**
+		 * Decode the code point text starts with.
+		 *
+		 * Invalid, overlong & truncated sequences decode as kREPLACEMENT_CHAR
+		 * with a length of one, so decoding always makes progress.
+		 */
+		static CodePoint Decode(std::string_view text) noexcept;
+		//! Encode a code point into pOutput (kMAX_SEQUENCE_LENGTH bytes), returns its length.
+		static std::size_t Encode(char32_t codePoint, char *pOutput) noexcept;
+		static std::size_t CountCodePoints(std::string_view text) noexcept;
+		//! Letters & combining marks, the characters words are made of.
+		static bool IsLetter(char32_t codePoint) noexcept;
+		/**
+		 * Lowercase a Latin letter, other code points are returned unchanged.
+		 *
+		 * Only mappings that keep the UTF-8 length are applied, so words can
+		 * be case mapped in place.
+		 */
+		static char32_t ToLower(char32_t codePoint) noexcept;
+		//! Uppercase a Latin letter (see ToLower()).
+		static char32_t ToUpper(char32_t codePoint) noexcept;
+		static bool IsUpper(char32_t codePoint) noexcept;
+		//! Determine whether or not a code point has another case (uncased letters are neither upper nor lower).
+		static bool IsCased(char32_t codePoint) noexcept;
+	private:
+		static bool IsLetterTable(char32_t codePoint) noexcept;
+		static char32_t ToLowerTable(char32_t codePoint) noexcept;
+		static char32_t ToUpperTable(char32_t codePoint) noexcept;
+	};
+
+	inline bool Unicode::IsAscii(char ch) noexcept
+	{
+		return static_cast<unsigned char>(ch) < 0x80;
+	}
+
+	inline bool Unicode::IsContinuationByte(char ch) noexcept
+	{
+		return (static_cast<unsigned char>(ch) & 0xC0) == 0x80;
+	}
+
+	inline std::size_t Unicode::GetSequenceLength(char lead) noexcept
+	{
+		const auto kLead = static_cast<unsigned char>(lead);
+		if (kLead < 0x80)
+		{
+			return 1;
+		}
+		else if (kLead < 0xC2)
+		{
+			return 0; // Continuation byte or overlong lead
+		}
+		else if (kLead < 0xE0)
+		{
+			return 2;
+		}
+		else if (kLead < 0xF0)
+		{
+			return 3;
+		}
+
+		return (kLead < 0xF5) ? 4 : 0;
+	}
+
+	inline bool Unicode::IsLetter(char32_t codePoint) noexcept
+	{
+		if (codePoint < 0x80)
+		{
+			return static_cast<char32_t>((codePoint | 0x20) - 'a') < 26;
+		}
+
+		return IsLetterTable(codePoint);
+	}
+
+	inline char32_t Unicode::ToLower(char32_t codePoint) noexcept
+	{
+		if (codePoint < 0x80)
+		{
+			return (codePoint - 'A' < 26) ? (codePoint | 0x20) : codePoint;
+		}
+
+		return ToLowerTable(codePoint);
+	}
+
+	inline char32_t Unicode::ToUpper(char32_t codePoint) noexcept
+	{
+		if (codePoint < 0x80)
+		{
+			return (codePoint - 'a' < 26) ? (codePoint & ~0x20u) : codePoint;
+		}
+
+		return ToUpperTable(codePoint);
+	}
+
+	inline bool Unicode::IsUpper(char32_t codePoint) noexcept
+	{
+		return ToLower(codePoint) != codePoint;
+	}
+
+	inline bool Unicode::IsCased(char32_t codePoint) noexcept
+	{
+		return ToLower(codePoint) != codePoint || ToUpper(codePoint) != codePoint;
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_UNICODE_HPP */
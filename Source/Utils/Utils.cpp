@@ -31,29 +31,212 @@
 #include "LexiStd.hpp"
 #include "Utils.hpp"
 
-bool Lexi::IsStringAlpha(std::string_view input)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LEXI_X86_DISPATCH // Kernels compiled per target, picked at runtime
+#define LEXI_TARGET(ISA) __attribute__((target(ISA)))
+#endif
+
+namespace
 {
-	return std::ranges::all_of(input,
-							   [](char ch) -> bool
-							   {
-								   return std::isalpha(static_cast<unsigned char>(ch)) != 0;
-							   });
-}
+	using Lexi::SimdLevel;
+
+	//! String kernels for one instruction set.
+	struct StringKernels
+	{
+		SimdLevel level;
+		bool (*pIsAlpha)(const char *pInput, std::size_t size) noexcept;
+		void (*pToLower)(const char *pInput, char *pOutput, std::size_t size) noexcept;
+	};
+
+	constexpr bool IsAsciiAlpha(char ch) noexcept
+	{
+		return static_cast<unsigned char>((static_cast<unsigned char>(ch) | 0x20) - 'a') < 26;
+	}
+
+	constexpr char ToAsciiLower(char ch) noexcept
+	{
+		return (static_cast<unsigned char>(ch - 'A') < 26) ? static_cast<char>(ch | 0x20) : ch;
+	}
+	// Scalar reference, also finishes the tails of the vector kernels.
+	bool IsAlphaScalar(const char *pInput, std::size_t size) noexcept
+	{
+		return std::all_of(pInput, pInput + size, IsAsciiAlpha);
+	}
+
+	void ToLowerScalar(const char *pInput, char *pOutput, std::size_t size) noexcept
+	{
+		std::transform(pInput, pInput + size, pOutput, ToAsciiLower);
+	}
+
+	constexpr StringKernels kSCALAR_KERNELS{ SimdLevel::kScalar, IsAlphaScalar, ToLowerScalar };
+#if defined(LEXI_X86_DISPATCH)
+	/*
+	 * Byte ranges are tested with one signed compare: adding 0x80 - first
+	 * moves the range onto the smallest signed bytes, so the test becomes
+	 * "less than -0x80 + count".
+	 */
+	LEXI_TARGET("sse2") bool IsAlphaSSE2(const char *pInput, std::size_t size) noexcept
+	{
+		const __m128i kCase = _mm_set1_epi8(0x20);
+		const __m128i kOffset = _mm_set1_epi8(static_cast<char>(0x80 - 'a'));
+		const __m128i kLimit = _mm_set1_epi8(static_cast<char>(-0x80 + 26));
+		std::size_t index = 0;
+		for (; index + 16 <= size; index += 16)
+		{
+			const __m128i kBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pInput + index));
+			const __m128i kShifted = _mm_add_epi8(_mm_or_si128(kBytes, kCase), kOffset);
+			if (_mm_movemask_epi8(_mm_cmplt_epi8(kShifted, kLimit)) != 0xFFFF)
+			{
+				return false;
+			}
+		}
+
+		return IsAlphaScalar(pInput + index, size - index);
+	}
+
+	LEXI_TARGET("sse2") void ToLowerSSE2(const char *pInput, char *pOutput, std::size_t size) noexcept
+	{
+		const __m128i kCase = _mm_set1_epi8(0x20);
+		const __m128i kOffset = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+		const __m128i kLimit = _mm_set1_epi8(static_cast<char>(-0x80 + 26));
+		std::size_t index = 0;
+		for (; index + 16 <= size; index += 16)
+		{
+			const __m128i kBytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pInput + index));
+			const __m128i kIsUpper = _mm_cmplt_epi8(_mm_add_epi8(kBytes, kOffset), kLimit);
+			const __m128i kLower = _mm_or_si128(kBytes, _mm_and_si128(kIsUpper, kCase));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(pOutput + index), kLower);
+		}
+
+		ToLowerScalar(pInput + index, pOutput + index, size - index);
+	}
+
+	LEXI_TARGET("avx2") bool IsAlphaAVX2(const char *pInput, std::size_t size) noexcept
+	{
+		const __m256i kCase = _mm256_set1_epi8(0x20);
+		const __m256i kOffset = _mm256_set1_epi8(static_cast<char>(0x80 - 'a'));
+		const __m256i kLimit = _mm256_set1_epi8(static_cast<char>(-0x80 + 26));
+		std::size_t index = 0;
+		for (; index + 32 <= size; index += 32)
+		{
+			const __m256i kBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pInput + index));
+			const __m256i kShifted = _mm256_add_epi8(_mm256_or_si256(kBytes, kCase), kOffset);
+			// No signed less-than in AVX2, so compare the other way around.
+			if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(kLimit, kShifted)) != -1)
+			{
+				return false;
+			}
+		}
+
+		return IsAlphaSSE2(pInput + index, size - index);
+	}
+
+	LEXI_TARGET("avx2") void ToLowerAVX2(const char *pInput, char *pOutput, std::size_t size) noexcept
+	{
+		const __m256i kCase = _mm256_set1_epi8(0x20);
+		const __m256i kOffset = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+		const __m256i kLimit = _mm256_set1_epi8(static_cast<char>(-0x80 + 26));
+		std::size_t index = 0;
+		for (; index + 32 <= size; index += 32)
+		{
+			const __m256i kBytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pInput + index));
+			const __m256i kIsUpper = _mm256_cmpgt_epi8(kLimit, _mm256_add_epi8(kBytes, kOffset));
+			const __m256i kLower = _mm256_or_si256(kBytes, _mm256_and_si256(kIsUpper, kCase));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(pOutput + index), kLower);
+		}
+
+		ToLowerSSE2(pInput + index, pOutput + index, size - index);
+	}
+
+	constexpr StringKernels kSSE2_KERNELS{ SimdLevel::kSSE2, IsAlphaSSE2, ToLowerSSE2 };
+	constexpr StringKernels kAVX2_KERNELS{ SimdLevel::kAVX2, IsAlphaAVX2, ToLowerAVX2 };
+#endif
 
-template <std::ranges::range Range>
-static auto ToString(Range &&range)
+	const StringKernels &GetKernels(SimdLevel level) noexcept
+	{
+		switch (level)
+		{
+#if defined(LEXI_X86_DISPATCH)
+		case SimdLevel::kAVX2:
+			return kAVX2_KERNELS;
+		case SimdLevel::kSSE2:
+			return kSSE2_KERNELS;
+#endif
+		default:
+			return kSCALAR_KERNELS;
+		}
+	}
+
+	SimdLevel DetectSimdLevel(void) noexcept
+	{
+#if defined(LEXI_X86_DISPATCH)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return SimdLevel::kAVX2;
+		}
+		else if (__builtin_cpu_supports("sse2"))
+		{
+			return SimdLevel::kSSE2;
+		}
+#endif
+		return SimdLevel::kScalar;
+	}
+
+	std::atomic<const StringKernels *> s_pKernels{ nullptr }; //!< Selected on first use
+
+	const StringKernels &GetActiveKernels(void) noexcept
+	{
+		const StringKernels *pKernels = s_pKernels.load(std::memory_order_relaxed);
+		if (!pKernels)
+		{
+			pKernels = &GetKernels(Lexi::GetSupportedSimdLevel());
+			s_pKernels.store(pKernels, std::memory_order_relaxed);
+		}
+
+		return *pKernels;
+	}
+} // End anonymous namespace
+
+bool Lexi::IsStringAlpha(std::string_view input) noexcept
 {
-	auto commonRange = range | std::views::common;
-	return std::string(std::begin(commonRange), std::end(commonRange));
+	return GetActiveKernels().pIsAlpha(input.data(), input.size());
 }
 
 std::string Lexi::StringToLower(std::string_view input)
 {
-	auto toLower = [](unsigned char ch)
-	{
-		return std::tolower(ch);
-	};
-	
-	return ToString(std::views::transform(input, toLower));
+	std::string output(input.size(), '\0');
+	GetActiveKernels().pToLower(input.data(), output.data(), input.size());
+	return output;
+}
+
+std::string_view Lexi::StringToLower(std::string_view input, char *pOutput) noexcept
+{
+	GetActiveKernels().pToLower(input.data(), pOutput, input.size());
+	return { pOutput, input.size() };
+}
+
+void Lexi::StringToLowerInPlace(std::span<char> text) noexcept
+{
+	GetActiveKernels().pToLower(text.data(), text.data(), text.size());
+}
+
+Lexi::SimdLevel Lexi::GetSupportedSimdLevel(void) noexcept
+{
+	static const SimdLevel s_kSupported = DetectSimdLevel();
+	return s_kSupported;
+}
+
+Lexi::SimdLevel Lexi::GetSimdLevel(void) noexcept
+{
+	return GetActiveKernels().level;
+}
+
+Lexi::SimdLevel Lexi::SetSimdLevel(SimdLevel level) noexcept
+{
+	const StringKernels &kKernels = GetKernels(std::min(level, GetSupportedSimdLevel()));
+	s_pKernels.store(&kKernels, std::memory_order_relaxed);
+	return kKernels.level;
 }
 
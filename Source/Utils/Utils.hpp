@@ -53,10 +53,50 @@
 
 namespace Lexi
 {
+	/*
+	 * String helpers treat text as ASCII (like the "C" locale Lexi runs in):
+	 * only 'A'-'Z' & 'a'-'z' are letters, other bytes are left untouched.
+	 */
 	//! Determines if a string has all alphabetic characters.
-	bool IsStringAlpha(std::string_view input);
+	bool IsStringAlpha(std::string_view input) noexcept;
 	//! Convert a string to all lowercase letters.
 	std::string StringToLower(std::string_view input);
+	//! Convert a string to lowercase into pOutput (input.size() bytes, may equal input), returns the result.
+	std::string_view StringToLower(std::string_view input, char *pOutput) noexcept;
+	//! Convert a string to lowercase in place.
+	void StringToLowerInPlace(std::span<char> text) noexcept;
+
+	//! Instruction sets the string helpers can use, in increasing order.
+	enum struct SimdLevel
+	{
+		kScalar,
+		kSSE2,
+		kAVX2
+	};
+	//! Retrieve the best level the CPU supports (detected once).
+	SimdLevel GetSupportedSimdLevel(void) noexcept;
+	//! Retrieve the level the string helpers currently use.
+	SimdLevel GetSimdLevel(void) noexcept;
+	//! Select a (lower) level, clamped to the supported one, returns the level in use.
+	SimdLevel SetSimdLevel(SimdLevel level) noexcept;
+	constexpr std::string_view SimdLevelToString(SimdLevel level) noexcept;
+
+	inline constexpr std::string_view SimdLevelToString(SimdLevel level) noexcept
+	{
+		using enum SimdLevel;
+
+		switch (level)
+		{
+		case kScalar:
+			return "Scalar";
+		case kSSE2:
+			return "SSE2";
+		case kAVX2:
+			return "AVX2";
+		default:
+			return "Unknown";
+		}
+	}
 } // End namespace (Lexi)
 
 #endif /* !LEXI_UTILS_HPP */
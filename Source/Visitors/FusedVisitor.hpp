@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * @file   FusedVisitor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Runs several static visitors in one traversal.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_FUSEDVISITOR_HPP
+#define LEXI_FUSEDVISITOR_HPP
+
+namespace Lexi
+{
+	/**
+	 * Composite visitor running several static visitors in one traversal.
+	 *
+	 * Every call is passed on to each visitor (in order) that needs the
+	 * glyph kind involved, so the document is walked once & each block or
+	 * stretch of text is seen by all visitors while it is still in cache.
+	 * Single characters are collected & handed out as text when the row ends
+	 * (or kTEXT_BATCH_SIZE are pending), long text in batches of that size.
+	 * A block goes whole to visitors needing characters; those needing only
+	 * rows get one VisitRow() per row of it instead.
+	 * The fused visitor needs the union of the visitors' kinds, so traversals
+	 * still skip what none of them needs.
+	 *
+	 * The visitors are referenced, not owned. Call Flush() before reading
+	 * their results; the destructor flushes as well, but can only log errors.
+	 */
+	template <StaticVisitorType... Visitors>
+	class FusedVisitor final : public StaticVisitor<FusedVisitor<Visitors...>>
+	{
+	public:
+		static constexpr std::size_t kTEXT_BATCH_SIZE = 16 * 1024;
+		static constexpr GlyphKindMask kGLYPH_KINDS = (GlyphKindMask{ 0 } | ... | Visitors::kGLYPH_KINDS);
+	private:
+		std::tuple<Visitors &...> m_visitors;
+		std::string m_pendingText; //!< Characters not yet passed on
+	public:
+		explicit FusedVisitor(Visitors &...visitors);
+		FusedVisitor(const FusedVisitor &) = delete;
+		FusedVisitor &operator=(const FusedVisitor &) = delete;
+		//! Flushes, logging any error instead of throwing it.
+		~FusedVisitor(void) override;
+
+		void VisitCharacter(char ch);
+		void VisitRow(void);
+		void VisitImage(void);
+		void VisitText(std::span<const char> text);
+		void VisitBlock(const GlyphBlock &kBlock);
+		//! Pass the pending characters on.
+		void Flush(void);
+	private:
+		//! Pass text on in batches, without flushing first.
+		void VisitTextBatches(std::span<const char> text);
+		//! Invoke func(visitor) for every visitor needing one of the kinds.
+		template <GlyphKindMask kKinds, typename Func>
+		void ForEachVisitor(Func &&func);
+	};
+
+	template <StaticVisitorType... Visitors>
+	inline FusedVisitor<Visitors...>::FusedVisitor(Visitors &...visitors)
+		: m_visitors(visitors...),
+		  m_pendingText{}
+	{
+		m_pendingText.reserve(kTEXT_BATCH_SIZE);
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline FusedVisitor<Visitors...>::~FusedVisitor(void)
+	{
+		// Destructors mustn't throw (the stack may already be unwinding), so errors are only logged.
+		try
+		{
+			Flush();
+		}
+		catch (const Exception &kExcept)
+		{
+			LEXI_ERR("Fused visitor flush failed({}:{}): {}", kExcept.GetFilename(), kExcept.GetLineNum(), kExcept.VWhat());
+		}
+		catch (const std::exception &kExcept)
+		{
+			LEXI_ERR("Fused visitor flush failed: {}", kExcept.what());
+		}
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitCharacter(char ch)
+	{
+		m_pendingText.push_back(ch);
+		if (m_pendingText.size() == kTEXT_BATCH_SIZE)
+		{
+			Flush();
+		}
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitRow(void)
+	{
+		Flush();
+		ForEachVisitor<kGLYPH_KIND_MASK<GlyphKind::kRow>>([](auto &visitor) { visitor.VisitRow(); });
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitImage(void)
+	{
+		Flush();
+		ForEachVisitor<kGLYPH_KIND_MASK<GlyphKind::kImage>>([](auto &visitor) { visitor.VisitImage(); });
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitText(std::span<const char> text)
+	{
+		Flush();
+		VisitTextBatches(text);
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitTextBatches(std::span<const char> text)
+	{
+		for (std::size_t offset = 0; offset < text.size(); offset += kTEXT_BATCH_SIZE)
+		{
+			const auto kBatch = text.subspan(offset, std::min(kTEXT_BATCH_SIZE, text.size() - offset));
+			ForEachVisitor<kGLYPH_KIND_MASK<GlyphKind::kCharacter>>([kBatch](auto &visitor) { visitor.VisitText(kBatch); });
+		}
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::VisitBlock(const GlyphBlock &kBlock)
+	{
+		Flush();
+		ForEachVisitor<kGLYPH_KIND_MASK<GlyphKind::kCharacter, GlyphKind::kRow>>([&kBlock](auto &visitor)
+		{
+			if constexpr ((std::remove_cvref_t<decltype(visitor)>::kGLYPH_KINDS & kGLYPH_KIND_MASK<GlyphKind::kCharacter>) != 0)
+			{
+				visitor.VisitBlock(kBlock);
+			}
+			else
+			{
+				// StaticVisitor::VisitBlock() would stream every character past it.
+				for (std::size_t index = 0; index < kBlock.GetNumRows(); ++index)
+				{
+					visitor.VisitRow();
+				}
+			}
+		});
+	}
+
+	template <StaticVisitorType... Visitors>
+	inline void FusedVisitor<Visitors...>::Flush(void)
+	{
+		if (!m_pendingText.empty())
+		{
+			VisitTextBatches(m_pendingText);
+			m_pendingText.clear();
+		}
+	}
+
+	template <StaticVisitorType... Visitors>
+	template <GlyphKindMask kKinds, typename Func>
+	inline void FusedVisitor<Visitors...>::ForEachVisitor(Func &&func)
+	{
+		std::apply([&func](auto &...visitors)
+		{
+			([&func](auto &visitor)
+			{
+				if constexpr ((std::remove_cvref_t<decltype(visitor)>::kGLYPH_KINDS & kKinds) != 0)
+				{
+					func(visitor);
+				}
+			}(visitors), ...);
+		}, m_visitors);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_FUSEDVISITOR_HPP */
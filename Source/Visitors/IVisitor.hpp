@@ -35,6 +35,12 @@ namespace Lexi
 {
 	class IVisitor;
 	LEXI_DECLARE_PTR(IVisitor);
+	class GlyphBlock;
+	template <typename Derived>
+	class StaticVisitor;
+	//! Visitor types that glyphs can call without virtual dispatch (see StaticVisitor).
+	template <typename Visitor>
+	concept StaticVisitorType = std::derived_from<Visitor, StaticVisitor<Visitor>>;
 	//! Interface for visiting glyphs in the document structure.
 	class IVisitor
 	{
@@ -44,7 +50,25 @@ namespace Lexi
 		virtual void VVisitCharacter(char ch /* Character *pChar */) = 0;
 		virtual void VVisitRow(/* Row *pRow */) = 0;
 		virtual void VVisitImage(/* Image *pImage */) = 0;
+		//! Visit a run of characters at once, defaults to one VVisitCharacter call per character.
+		virtual void VVisitText(std::span<const char> text);
+		/**
+		 * Visit a whole block of rows at once.
+		 *
+		 * Defaults to VVisitText() with the text of each row followed by
+		 * VVisitRow(). Visitors that work on positions or code points should
+		 * override it & read the block's arrays directly.
+		 */
+		virtual void VVisitBlock(const GlyphBlock &kBlock);
 	};
+
+	inline void IVisitor::VVisitText(std::span<const char> text)
+	{
+		for (const char kCh : text)
+		{
+			VVisitCharacter(kCh);
+		}
+	}
 } // End namespace (Lexi)
 
 #endif /* !LEXI_IVISITOR_HPP */
@@ -34,72 +34,321 @@
 using Lexi::SpellCheckVisitor;
 
 SpellCheckVisitor::SpellCheckVisitor(void)
+	: SpellCheckVisitor(DictionaryRegistry::Get().AcquireConfigured(), DictionaryRegistry::Get().GetUserDictionary())
+{
+	const Config::User &kUser = Config::Get().GetUser();
+	LEXI_LOG("Word dict path: {}", kUser.wordDictPath);
+
+	const IDictionary &kBase = m_pDictionary->GetBase();
+	const std::size_t kNumWords = kBase.VGetSize();
+	const std::size_t kNumBytes = kBase.VGetMemoryUsage();
+	LEXI_LOG("Using {} words in {} storage ({} bytes, {:.1f} bytes per word, {} visitor(s) sharing it).",
+			 kNumWords, Config::DictionaryStorageToString(kUser.wordDictStorage), kNumBytes,
+			 (kNumWords > 0) ? static_cast<double>(kNumBytes) / static_cast<double>(kNumWords) : 0.0,
+			 m_pDictionary->GetBaseHandle().use_count());
+}
+
+SpellCheckVisitor::SpellCheckVisitor(DictionaryHandle pDictionary, StrongMutableDictionaryPtr pUserDictionary)
 	: m_currWord{},
+	  m_currWordOffset(0),
+	  m_offset(0),
+	  m_pendingSequence{},
+	  m_pendingSequenceOffset(0),
 	  m_misspellings{},
-	  m_words{}
+	  m_caseBuffer{},
+	  m_pDictionary{},
+	  m_pendingDictionary{},
+	  m_pUserDictionary(std::move(pUserDictionary)),
+	  m_deferredChars{},
+	  m_deferredWords{},
+	  m_pSuggestionEngine{},
+	  m_suggestionGeneration(0),
+	  m_pRowChecker{}
 {
-	Config &config = Config::Get();
+	LEXI_THROW_IF(!pDictionary, "Spell checker needs a dictionary!");
+	BindDictionary(std::move(pDictionary));
+}
 
-	std::ifstream inFile;
-	inFile.exceptions(std::ios::badbit);
-	inFile.open(config.GetUser().wordDictPath);
-	LEXI_LOG("Word dict path: {}", config.GetUser().wordDictPath);
+SpellCheckVisitor::SpellCheckVisitor(PendingDictionary pendingDictionary, StrongMutableDictionaryPtr pUserDictionary)
+	: m_currWord{},
+	  m_currWordOffset(0),
+	  m_offset(0),
+	  m_pendingSequence{},
+	  m_pendingSequenceOffset(0),
+	  m_misspellings{},
+	  m_caseBuffer{},
+	  m_pDictionary{},
+	  m_pendingDictionary(std::move(pendingDictionary)),
+	  m_pUserDictionary(std::move(pUserDictionary)),
+	  m_deferredChars{},
+	  m_deferredWords{},
+	  m_pSuggestionEngine{},
+	  m_suggestionGeneration(0),
+	  m_pRowChecker{}
+{
+	LEXI_THROW_IF(!m_pendingDictionary.valid(), "Spell checker needs a dictionary!");
+}
 
-	for (std::string line; std::getline(inFile, line); )
+void SpellCheckVisitor::VisitOtherCharacter(char ch)
+{
+	if (!Unicode::IsAscii(ch))
 	{
-		std::istringstream inStrStream(line);
-		Word word;
-		inStrStream >> word;
-
-		m_words.push_back(word);
+		VisitMultiByte(ch);
+		++m_offset;
+		return;
+	}
+	else if (!m_pendingSequence.empty())
+	{
+		// An incomplete sequence is not a letter.
+		m_pendingSequence.clear();
+		EndWord();
 	}
-}
 
-void SpellCheckVisitor::VVisitCharacter(char ch)
-{
-	if (std::isalpha(ch))
+	if (WordTokenizer::IsWordChar(ch))
 	{
 		// Append alphabetic character to current word
+		if (m_currWord.empty())
+		{
+			m_currWordOffset = m_offset;
+		}
+
 		m_currWord += ch;
 	}
 	else
 	{
 		// Non alphabetic character encountered
 		// Check spelling of current word
-		bool bEmpty = m_currWord.empty();
-		bool bMoreThanOneChar = (m_currWord.size() > 1);
-		bool bAllAlpha = IsStringAlpha(m_currWord);
-		
-		if (!bEmpty && bMoreThanOneChar && bAllAlpha && VIsMisspelled(StringToLower(m_currWord)))
+		EndWord();
+	}
+
+	++m_offset;
+}
+
+void SpellCheckVisitor::VisitRow(void)
+{
+	// The end of a row always ends the current word.
+	m_pendingSequence.clear();
+	EndWord();
+}
+
+void SpellCheckVisitor::VisitText(std::span<const char> text)
+{
+	std::string_view textView(text.data(), text.size());
+	// Finish the word (or character) left pending by the previous call.
+	while (!textView.empty() && (!m_currWord.empty() || !m_pendingSequence.empty()))
+	{
+		VisitCharacter(textView.front());
+		textView.remove_prefix(1);
+	}
+
+	// A trailing incomplete sequence may still become a letter, so it is visited byte-wise.
+	std::size_t bulkSize = textView.size();
+	for (std::size_t numBack = 1; numBack < Unicode::kMAX_SEQUENCE_LENGTH && numBack <= textView.size(); ++numBack)
+	{
+		const char kCh = textView[textView.size() - numBack];
+		if (!Unicode::IsContinuationByte(kCh))
+		{
+			bulkSize = (Unicode::GetSequenceLength(kCh) > numBack) ? textView.size() - numBack : bulkSize;
+			break;
+		}
+	}
+
+	const std::string_view kBulk = textView.substr(0, bulkSize);
+	const std::uint32_t kTextOffset = m_offset;
+	m_offset += static_cast<std::uint32_t>(kBulk.size());
+	WordTokenizer::ForEachRun(kBulk, [this, kBulk, kTextOffset](const WordRange &kRange)
+	{
+		const auto kWord = kBulk.substr(kRange.offset, kRange.length);
+		if (kRange.offset + kRange.length == kBulk.size())
+		{
+			m_currWord.assign(kWord);
+			m_currWordOffset = kTextOffset + kRange.offset;
+		}
+		else
 		{
-			// Add the current word to the misspelled word list
-			m_misspellings.push_back(m_currWord);
+			CheckWord(kWord, kTextOffset + kRange.offset);
 		}
-		// Reset the current word
-		m_currWord.clear();
+	});
+
+	for (const char kCh : textView.substr(bulkSize))
+	{
+		VisitCharacter(kCh);
 	}
 }
 
-void SpellCheckVisitor::VVisitRow(void)
+bool SpellCheckVisitor::WaitForDictionary(std::chrono::milliseconds timeout)
 {
+	if (!m_pDictionary)
+	{
+		if (m_pendingDictionary.wait_for(timeout) != std::future_status::ready)
+		{
+			return false;
+		}
+
+		BindDictionary(m_pendingDictionary.get());
+	}
+
+	return true;
 }
 
-void SpellCheckVisitor::VVisitImage(void)
+void SpellCheckVisitor::WaitForDictionary(void)
 {
+	if (!m_pDictionary)
+	{
+		BindDictionary(m_pendingDictionary.get());
+	}
 }
 
-const SpellCheckVisitor::WordVector &SpellCheckVisitor::GetMisspellings(void) const
+Lexi::SuggestionEngine::Suggestions SpellCheckVisitor::Suggest(std::string_view word, std::size_t maxResults,
+																SuggestionEngine::Microseconds budget)
+{
+	WaitForDictionary();
+	// The index holds the words themselves, so any change to the dictionary means building it again.
+	const std::uint64_t kGeneration = m_pDictionary->VGetGeneration();
+	if (!m_pSuggestionEngine || kGeneration != m_suggestionGeneration)
+	{
+		m_pSuggestionEngine = std::make_unique<SuggestionEngine>(*m_pDictionary);
+		m_suggestionGeneration = kGeneration;
+		LEXI_LOG("Suggestion index built ({} bytes).", m_pSuggestionEngine->GetMemoryUsage());
+	}
+
+	std::string folded(word);
+	CaseFolding::FoldWord(folded, folded.data());
+	return m_pSuggestionEngine->Suggest(folded, maxResults, budget);
+}
+
+const SpellCheckVisitor::MisspellingVector &SpellCheckVisitor::GetMisspellings(void) const
 {
 	return m_misspellings;
 }
 
-const SpellCheckVisitor::WordVector &SpellCheckVisitor::GetWords(void) const
+const Lexi::LayeredDictionary &SpellCheckVisitor::GetDictionary(void) const
 {
-	return m_words;
+	LEXI_THROW_IF(!m_pDictionary, "The dictionary is still loading!");
+	return *m_pDictionary;
+}
+
+Lexi::LayeredDictionary &SpellCheckVisitor::GetDictionary(void)
+{
+	WaitForDictionary();
+	return *m_pDictionary;
+}
+
+bool SpellCheckVisitor::IsDictionaryReady(void) const noexcept
+{
+	return m_pDictionary != nullptr;
+}
+
+Lexi::IncrementalSpellChecker &SpellCheckVisitor::GetRowChecker(void)
+{
+	WaitForDictionary();
+	m_pRowChecker->Refresh();
+	return *m_pRowChecker;
+}
+
+bool SpellCheckVisitor::VIsMisspelled(std::string_view word)
+{
+	return !m_pDictionary->VContains(word);
+}
+
+void SpellCheckVisitor::BindDictionary(DictionaryHandle pDictionary)
+{
+	m_pDictionary = std::make_unique<LayeredDictionary>(std::move(pDictionary), std::move(m_pUserDictionary));
+	m_pendingDictionary = {};
+	m_pRowChecker = std::make_unique<IncrementalSpellChecker>(*m_pDictionary);
+	// Queued words precede everything visited from now on, so misspellings stay in document order.
+	std::string_view deferredChars = m_deferredChars;
+	for (const auto &kRange : m_deferredWords)
+	{
+		CheckWord(deferredChars.substr(0, kRange.length), kRange.offset);
+		deferredChars.remove_prefix(kRange.length);
+	}
+
+	m_deferredChars = {};
+	m_deferredWords = {};
+}
+
+void SpellCheckVisitor::VisitMultiByte(char ch)
+{
+	if (Unicode::IsContinuationByte(ch) && !m_pendingSequence.empty())
+	{
+		m_pendingSequence += ch;
+		if (m_pendingSequence.size() < Unicode::GetSequenceLength(m_pendingSequence.front()))
+		{
+			return;
+		}
+
+		const Unicode::CodePoint kCodePoint = Unicode::Decode(m_pendingSequence);
+		if (kCodePoint.length == m_pendingSequence.size() && WordTokenizer::IsWordCodePoint(kCodePoint.value))
+		{
+			if (m_currWord.empty())
+			{
+				m_currWordOffset = m_pendingSequenceOffset;
+			}
+
+			m_currWord += m_pendingSequence;
+		}
+		else
+		{
+			EndWord();
+		}
+
+		m_pendingSequence.clear();
+		return;
+	}
+
+	// A lead byte or a stray continuation byte, either way any pending sequence is incomplete.
+	if (!m_pendingSequence.empty())
+	{
+		m_pendingSequence.clear();
+		EndWord();
+	}
+
+	if (Unicode::GetSequenceLength(ch) > 1)
+	{
+		m_pendingSequence.assign(1, ch);
+		m_pendingSequenceOffset = m_offset;
+	}
+	else
+	{
+		EndWord();
+	}
+}
+
+void SpellCheckVisitor::EndWord(void)
+{
+	CheckWord(m_currWord, m_currWordOffset);
+	// Reset the current word
+	m_currWord.clear();
+}
+
+void SpellCheckVisitor::CheckWord(std::string_view word, std::uint32_t offset)
+{
+	// Runs only contain letters, so length is all that is left to check.
+	if (!WordTokenizer::IsCheckable(word))
+	{
+		return;
+	}
+
+	if (!WaitForDictionary(std::chrono::milliseconds::zero()))
+	{
+		// Check it once the dictionary has loaded.
+		m_deferredChars.append(word);
+		m_deferredWords.push_back(WordRange{ offset, static_cast<std::uint32_t>(word.size()) });
+	}
+	else if (VIsMisspelled(word))
+	{
+		// Record where the misspelled word is
+		const WordRange kRange{ offset, static_cast<std::uint32_t>(word.size()) };
+		m_misspellings.push_back(Misspelling{ kRange, GetMissReason(word) });
+	}
 }
 
-bool SpellCheckVisitor::VIsMisspelled(const Word &kWord)
+SpellCheckVisitor::MissReason SpellCheckVisitor::GetMissReason(std::string_view word)
 {
-	return (std::ranges::find(m_words, kWord) == m_words.end());
+	// All caps is accepted for every listed word, so it tells a capitalization miss apart.
+	m_caseBuffer.assign(word);
+	CaseFolding::UpperWord(m_caseBuffer, m_caseBuffer.data());
+	return m_pDictionary->VContains(m_caseBuffer) ? MissReason::kCapitalization : MissReason::kUnknownWord;
 }
 
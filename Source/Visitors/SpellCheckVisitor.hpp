@@ -36,29 +36,166 @@ namespace Lexi
 	class SpellCheckVisitor;
 	LEXI_DECLARE_PTR(SpellCheckVisitor);
 	
-	//! Visitor for checking spelling of glyphs.
-	class SpellCheckVisitor : public IVisitor
+	/**
+	 * Visitor for checking spelling of glyphs.
+	 *
+	 * Misspellings are recorded as ranges of the visited text: offsets count
+	 * the characters passed to VisitCharacter() & VisitText() so far.
+	 * Characters are UTF-8 bytes, a multi-byte letter may be visited one byte
+	 * at a time.
+	 *
+	 * The dictionary may still be loading when visiting starts; words are
+	 * then queued and checked as soon as it is available.
+	 *
+	 * Static traversals inline the common case of VisitCharacter(), a letter
+	 * continuing the current word.
+	 */
+	class SpellCheckVisitor : public StaticVisitor<SpellCheckVisitor>
 	{
 	public:
 		using Word = std::string;
-		using WordVector = std::vector<Word>;
+		//! Why the dictionary rejected a word.
+		enum struct MissReason : std::uint8_t
+		{
+			kUnknownWord, //!< Not in the dictionary at all
+			kCapitalization //!< Listed, but not with this capitalization ("aarhus")
+		};
+		//! A misspelled word within the visited text.
+		struct Misspelling
+		{
+			WordRange range; //!< Document offset & length
+			MissReason reason;
+
+			auto operator<=>(const Misspelling &) const = default;
+		};
+		using MisspellingVector = std::vector<Misspelling>;
 	private:
 		Word m_currWord; //!< The current word
-		WordVector m_misspellings; //!< Currently misspelled words
-		WordVector m_words; //!< Dictionary (or word list)
+		std::uint32_t m_currWordOffset; //!< Document offset of the current word
+		std::uint32_t m_offset; //!< Characters visited so far
+		std::string m_pendingSequence; //!< Bytes of a multi-byte character visited so far
+		std::uint32_t m_pendingSequenceOffset; //!< Document offset of its lead byte
+		MisspellingVector m_misspellings; //!< Currently misspelled words
+		Word m_caseBuffer; //!< Scratch space for classifying misses
+		UniqueLayeredDictionaryPtr m_pDictionary; //!< Shared dictionary & this document's layers (once loaded)
+		PendingDictionary m_pendingDictionary; //!< Dictionary still loading
+		StrongMutableDictionaryPtr m_pUserDictionary; //!< Layered over the dictionary once it has loaded
+		std::string m_deferredChars; //!< Characters of the words visited before the dictionary loaded
+		std::vector<WordRange> m_deferredWords; //!< Document ranges of those words
+		UniqueSuggestionEnginePtr m_pSuggestionEngine; //!< Built on the first suggestion request
+		std::uint64_t m_suggestionGeneration; //!< Dictionary generation the suggestion index was built at
+		UniqueIncrementalSpellCheckerPtr m_pRowChecker; //!< Cached per-row results (incremental mode)
 	public:
 		// TODO: Maintain reference to document structure?
+		//! Check against the configured dictionary & user dictionary (shared through the registry).
 		SpellCheckVisitor(void);
-		// IVisitor overrides:
-		void VVisitCharacter(char ch /* Character *pChar */) override;
-		void VVisitRow(/* Row *pRow */) override;
-		void VVisitImage(/* Image *pImage */) override;
+		//! Check against an already loaded dictionary, optionally layering a user dictionary over it.
+		explicit SpellCheckVisitor(DictionaryHandle pDictionary, StrongMutableDictionaryPtr pUserDictionary = nullptr);
+		//! Start visiting while the dictionary is loading (see DictionaryRegistry::AcquireAsync()).
+		explicit SpellCheckVisitor(PendingDictionary pendingDictionary,
+								   StrongMutableDictionaryPtr pUserDictionary = nullptr);
+		// StaticVisitor members (also reached through IVisitor):
+		void VisitCharacter(char ch);
+		void VisitRow(void);
+		/**
+		 * Tokenize a run of characters in bulk.
+		 *
+		 * A word touching the end of the text is kept pending, like with
+		 * VisitCharacter, until a later character or row ends it.
+		 */
+		void VisitText(std::span<const char> text);
+		/**
+		 * Wait up to timeout for the dictionary to load.
+		 *
+		 * Queued words are checked once it has; returns false on timeout.
+		 * Rethrows the error if the dictionary failed to load.
+		 */
+		bool WaitForDictionary(std::chrono::milliseconds timeout);
+		//! Wait for the dictionary to load (see above).
+		void WaitForDictionary(void);
+		/**
+		 * Suggest corrections for a (misspelled) word, waits for the dictionary.
+		 *
+		 * The suggestion index is built again once the dictionary changed
+		 * (a reload or a word added to the user dictionary).
+		 */
+		SuggestionEngine::Suggestions Suggest(std::string_view word,
+											  std::size_t maxResults = SuggestionEngine::kDEFAULT_MAX_RESULTS,
+											  SuggestionEngine::Microseconds budget = SuggestionEngine::kDEFAULT_BUDGET);
 		// Accessors:
-		const WordVector &GetMisspellings(void) const;
-		const WordVector &GetWords(void) const;
+		//! Words still queued for the dictionary are not included.
+		const MisspellingVector &GetMisspellings(void) const;
+		/**
+		 * Retrieve the misspelled words as owned strings.
+		 *
+		 * kText is the visited text the offsets refer to; strings are only
+		 * built as the returned view is iterated.
+		 */
+		auto GetMisspelledWords(std::string_view text) const;
+		//! Throws if the dictionary is still loading.
+		const LayeredDictionary &GetDictionary(void) const;
+		//! Retrieve the dictionary to ignore words or add them to the user dictionary, waits for it to load.
+		LayeredDictionary &GetDictionary(void);
+		bool IsDictionaryReady(void) const noexcept;
+		/**
+		 * Retrieve the incremental (per-row) checker.
+		 *
+		 * Editors report changed rows through it, so only dirty rows are
+		 * tokenized & looked up again. Waits for the dictionary to load &
+		 * refreshes results made stale by words added or reloaded since.
+		 */
+		IncrementalSpellChecker &GetRowChecker(void);
+		static constexpr std::string_view MissReasonToString(MissReason reason) noexcept;
 	protected:
-		virtual bool VIsMisspelled(const Word &kWord);
+		virtual bool VIsMisspelled(std::string_view word);
+	private:
+		//! Layer & start using a loaded dictionary, checking the queued words.
+		void BindDictionary(DictionaryHandle pDictionary);
+		//! Visit any character but a letter continuing the current word.
+		void VisitOtherCharacter(char ch);
+		//! Assemble a byte of a multi-byte character, appending it to the current word once it is a complete letter.
+		void VisitMultiByte(char ch);
+		//! Check & reset the current word.
+		void EndWord(void);
+		//! Check a complete run of word characters starting at a document offset.
+		void CheckWord(std::string_view word, std::uint32_t offset);
+		MissReason GetMissReason(std::string_view word);
 	};
+
+	inline void SpellCheckVisitor::VisitCharacter(char ch)
+	{
+		if (!m_currWord.empty() && m_pendingSequence.empty() && WordTokenizer::IsWordChar(ch))
+		{
+			m_currWord += ch;
+			++m_offset;
+			return;
+		}
+
+		VisitOtherCharacter(ch);
+	}
+
+	inline constexpr std::string_view SpellCheckVisitor::MissReasonToString(MissReason reason) noexcept
+	{
+		using enum MissReason;
+
+		switch (reason)
+		{
+		case kUnknownWord:
+			return "Unknown word";
+		case kCapitalization:
+			return "Capitalization";
+		default:
+			return "Unknown";
+		}
+	}
+
+	inline auto SpellCheckVisitor::GetMisspelledWords(std::string_view text) const
+	{
+		return m_misspellings | std::views::transform([text](const Misspelling &kMisspelling)
+		{
+			return Word(text.substr(kMisspelling.range.offset, kMisspelling.range.length));
+		});
+	}
 } // End namespace (Lexi)
 
 #endif /* !LEXI_SPELLCHECKVISITOR_HPP */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file   StaticVisitor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Compile-time dispatched visitor.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_STATICVISITOR_HPP
+#define LEXI_STATICVISITOR_HPP
+
+namespace Lexi
+{
+	/**
+	 * Visitor dispatched at compile time (CRTP).
+	 *
+	 * Derived provides non-virtual VisitCharacter(char) & VisitRow(), and may
+	 * replace VisitText(), VisitImage() & VisitBlock(). Static traversals
+	 * (Character::Accept(), Row::Accept(), GlyphBlock::Accept() &
+	 * PieceTable::Accept()) call those directly when given the derived type,
+	 * so they can be inlined into the traversal loop.
+	 *
+	 * Derived may also declare the glyph kinds it needs by redefining
+	 * kGLYPH_KINDS; traversals skip the others (see FusedVisitor).
+	 *
+	 * The visitor remains an IVisitor: the virtual functions forward to the
+	 * same members, for plugins & code holding an IVisitor reference.
+	 */
+	template <typename Derived>
+	class StaticVisitor : public IVisitor, public Crtp<Derived>
+	{
+	public:
+		static constexpr GlyphKindMask kGLYPH_KINDS = kALL_GLYPH_KINDS;
+
+		//! Defaults to one VisitCharacter call per character.
+		void VisitText(std::span<const char> text);
+		void VisitImage(void);
+		//! Defaults to VisitText() with the text of each row followed by VisitRow().
+		void VisitBlock(const GlyphBlock &kBlock);
+		// IVisitor overrides:
+		void VVisitCharacter(char ch) final;
+		void VVisitRow(void) final;
+		void VVisitImage(void) final;
+		void VVisitText(std::span<const char> text) final;
+		void VVisitBlock(const GlyphBlock &kBlock) final;
+	};
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VisitText(std::span<const char> text)
+	{
+		for (const char kCh : text)
+		{
+			this->GetDerived().VisitCharacter(kCh);
+		}
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VisitImage(void)
+	{
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VisitBlock(const GlyphBlock &kBlock)
+	{
+		for (std::size_t index = 0; index < kBlock.GetNumRows(); ++index)
+		{
+			this->GetDerived().VisitText(kBlock.GetRow(index).text);
+			this->GetDerived().VisitRow();
+		}
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VVisitCharacter(char ch)
+	{
+		this->GetDerived().VisitCharacter(ch);
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VVisitRow(void)
+	{
+		this->GetDerived().VisitRow();
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VVisitImage(void)
+	{
+		this->GetDerived().VisitImage();
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VVisitText(std::span<const char> text)
+	{
+		this->GetDerived().VisitText(text);
+	}
+
+	template <typename Derived>
+	inline void StaticVisitor<Derived>::VVisitBlock(const GlyphBlock &kBlock)
+	{
+		this->GetDerived().VisitBlock(kBlock);
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_STATICVISITOR_HPP */
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * @file   WordCountVisitor.hpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Visitor counting characters, words & rows.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#ifndef LEXI_WORDCOUNTVISITOR_HPP
+#define LEXI_WORDCOUNTVISITOR_HPP
+
+namespace Lexi
+{
+	class WordCountVisitor;
+	LEXI_DECLARE_PTR(WordCountVisitor);
+
+	/**
+	 * Visitor counting characters, words & rows (like wc).
+	 *
+	 * Characters are code points; words are runs of anything but ASCII
+	 * whitespace, ended by whitespace or the end of a row.
+	 */
+	class WordCountVisitor final : public StaticVisitor<WordCountVisitor>
+	{
+	public:
+		static constexpr GlyphKindMask kGLYPH_KINDS = kGLYPH_KIND_MASK<GlyphKind::kCharacter, GlyphKind::kRow>;
+		struct Counts
+		{
+			std::size_t numCharacters;
+			std::size_t numWords;
+			std::size_t numRows;
+
+			auto operator<=>(const Counts &) const = default;
+		};
+	private:
+		Counts m_counts;
+		bool m_bInWord; //!< Whether or not the last character was part of a word
+	public:
+		WordCountVisitor(void);
+
+		void VisitCharacter(char ch);
+		void VisitRow(void);
+		void Reset(void) noexcept;
+		// Accessors:
+		const Counts &GetCounts(void) const noexcept;
+	};
+
+	inline void WordCountVisitor::VisitCharacter(char ch)
+	{
+		const bool kbSpace = ch == ' ' || (ch >= '\t' && ch <= '\r');
+		m_counts.numCharacters += !Unicode::IsContinuationByte(ch);
+		m_counts.numWords += !kbSpace && !m_bInWord;
+		m_bInWord = !kbSpace;
+	}
+} // End namespace (Lexi)
+
+#endif /* !LEXI_WORDCOUNTVISITOR_HPP */
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * @file   DictCompiler.cpp
+ * @author Brian Hoffpauir
+ * @date   17.10.2026
+ * @brief  Compiles a word list into a memory-mappable dictionary.
+ *
+ * Copyright (c) 2023, Brian Hoffpauir All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ ******************************************************************************/
+#include "LexiStd.hpp"
+
+using namespace Lexi;
+
+int main(int numArgs, char *pArgs[]) try
+{
+	if (numArgs != 3)
+	{
+		LEXI_ERR("Usage: {} <word list> <compiled dictionary>", pArgs[0]);
+		return 1;
+	}
+
+	const std::filesystem::path kInputPath = pArgs[1];
+	const std::filesystem::path kOutputPath = pArgs[2];
+
+	const HashDictionary kDictionary(kInputPath);
+	kDictionary.SaveBinary(kOutputPath);
+	LEXI_LOG("Compiled {} words from '{}' into '{}' (format version {}).",
+			 kDictionary.VGetSize(), kInputPath.string(), kOutputPath.string(), HashDictionary::kFILE_VERSION);
+	return 0;
+}
+catch (const Exception &kExcept)
+{
+	LEXI_ERR("Exception occured({}:{}): {}", kExcept.GetFilename(), kExcept.GetLineNum(), kExcept.VWhat());
+	return 1;
+}
+catch (const std::exception &kExcept)
+{
+	LEXI_ERR("Exception occured: {}", kExcept.what());
+	return 1;
+}
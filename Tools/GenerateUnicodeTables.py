@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# Generate Source/Utils/UnicodeTables.ipp from the Unicode Character Database
+# shipped with Python (unicodedata).
+#
+# Usage: python3 Tools/GenerateUnicodeTables.py > Source/Utils/UnicodeTables.ipp
+import unicodedata
+
+NUM_PLANE_BLOCKS = 0x300  # Letters are classified up to U+2FFFF
+LATIN_RANGES = [(0x00C0, 0x0250), (0x1E00, 0x1F00)]  # Latin-1 Supplement to Extended-B, Extended Additional
+
+
+def is_word_char(code_point):
+    if 0xD800 <= code_point < 0xE000:
+        return False
+    category = unicodedata.category(chr(code_point))
+    return category[0] == 'L' or category in ('Mn', 'Mc')
+
+
+def simple_mapping(code_point, mapped):
+    # Only one-to-one mappings that keep the UTF-8 length, so words can be mapped in place.
+    if len(mapped) != 1 or len(mapped.encode()) != len(chr(code_point).encode()):
+        return code_point
+    return ord(mapped)
+
+
+def emit_array(type_name, name, values, per_line, width):
+    print(f'\tconstexpr {type_name} {name}[{len(values)}] = {{')
+    for start in range(0, len(values), per_line):
+        line = ', '.join(f'0x{value:0{width}X}' for value in values[start:start + per_line])
+        print(f'\t\t{line},')
+    print('\t};')
+
+
+def main():
+    blocks = {}
+    block_index = []
+    for block in range(NUM_PLANE_BLOCKS):
+        bits = 0
+        for offset in range(256):
+            if is_word_char(block * 256 + offset):
+                bits |= 1 << offset
+        block_index.append(blocks.setdefault(bits, len(blocks)))
+
+    words = []
+    for bits in blocks:
+        words.extend((bits >> (64 * word)) & 0xFFFFFFFFFFFFFFFF for word in range(4))
+
+    print('// Generated by Tools/GenerateUnicodeTables.py from Unicode {}, do not edit.'.format(unicodedata.unidata_version))
+    print('namespace')
+    print('{')
+    print(f'\tconstexpr char32_t kNUM_LETTER_BLOCKS = 0x{NUM_PLANE_BLOCKS:X}; //!< 256 code point blocks classified')
+    print('\t//! Index into kLETTER_BITS of each 256 code point block.')
+    emit_array('std::uint8_t', 'kLETTER_BLOCK_INDEX', block_index, 16, 2)
+    print('\t//! 256-bit sets of the letters (& combining marks) in a block, 4 words per block.')
+    emit_array('std::uint64_t', 'kLETTER_BITS', words, 4, 16)
+    for (first, last), suffix in zip(LATIN_RANGES, ('A', 'B')):
+        lower = [simple_mapping(cp, chr(cp).lower()) for cp in range(first, last)]
+        upper = [simple_mapping(cp, chr(cp).upper()) for cp in range(first, last)]
+        print(f'\tconstexpr char32_t kLATIN_FIRST_{suffix} = 0x{first:04X};')
+        emit_array('char16_t', f'kLATIN_LOWER_{suffix}', lower, 12, 4)
+        emit_array('char16_t', f'kLATIN_UPPER_{suffix}', upper, 12, 4)
+    print('} // End anonymous namespace')
+
+
+if __name__ == '__main__':
+    main()